@@ -0,0 +1,112 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reads a column of doubles from comma separated text, once with a from_chars call per value
+// and once with a single from_chars_n call, as when loading a table from CSV or JSON.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static BOOST_NOINLINE void init_input_data( std::string& text, std::size_t& n, bool short_values )
+{
+    boost::detail::splitmix64 rng;
+    char buffer[ 64 ];
+
+    n = 0;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+        double x = short_values ? random_reading( tmp ) : random_double( tmp );
+
+        if( n != 0 )
+        {
+            text += ',';
+        }
+
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        text.append( buffer, r.ptr );
+        ++n;
+    }
+}
+
+static BOOST_NOINLINE void test_from_chars( std::string const& text, std::vector<double>& data, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char const* first = text.data();
+        char const* last = first + text.size();
+
+        for( std::size_t j = 0; j < data.size(); ++j )
+        {
+            first = boost::charconv::from_chars( first, last, data[ j ] ).ptr;
+
+            if( first != last && *first == ',' )
+            {
+                ++first;
+            }
+        }
+
+        s += data.back();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  from_chars, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars_n( std::string const& text, std::vector<double>& data, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        boost::charconv::from_chars_n( text.data(), text.data() + text.size(), data.data(), data.size() );
+        s += data.back();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "from_chars_n, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    for( bool short_values: { false, true } )
+    {
+        std::string text;
+        std::size_t n;
+        init_input_data( text, n, short_values );
+
+        std::vector<double> data( n );
+
+        char const* label = short_values ? "short " : "random";
+
+        test_from_chars( text, data, label );
+        test_from_chars_n( text, data, label );
+
+        std::cout << std::endl;
+    }
+}
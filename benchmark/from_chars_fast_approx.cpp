@@ -0,0 +1,99 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses doubles with from_chars and with from_chars_fast_approx: their shortest representations, which both
+// round with Eisel-Lemire, and 40 digit values close to halfway between two doubles, for which from_chars has to
+// compare the digits with big integer arithmetic.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 10;
+
+static std::vector<std::string> shortest;
+static std::vector<std::string> halfway;
+
+static BOOST_NOINLINE void init_input_data()
+{
+    boost::detail::splitmix64 rng;
+
+    char buffer[ 128 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) || x == 0 )
+        {
+            x = static_cast<double>( tmp % 1000000 ) / 1000 + 1;
+        }
+
+        shortest.emplace_back( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr );
+
+        // The exact halfway point to the next double, cut to 40 digits
+        double next = std::nextafter( x, x * 2 );
+        long double middle = ( static_cast<long double>( x ) + next ) / 2;
+        halfway.emplace_back( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), middle, boost::charconv::chars_format::scientific, 39 ).ptr );
+    }
+}
+
+template<bool Approx>
+static BOOST_NOINLINE void test( std::vector<std::string> const& data, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            double x = 0;
+
+            if( Approx )
+            {
+                boost::charconv::from_chars_fast_approx( str.data(), str.data() + str.size(), x );
+            }
+            else
+            {
+                boost::charconv::from_chars( str.data(), str.data() + str.size(), x );
+            }
+
+            std::uint64_t bits;
+            std::memcpy( &bits, &x, sizeof(bits) );
+            s += bits & 0xFF;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << label << ( Approx ? "from_chars_fast_approx: " : "            from_chars: " ) << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    init_input_data();
+
+    test<false>( shortest, "shortest, " );
+    test<true>( shortest, "shortest, " );
+
+    test<false>( halfway, " halfway, " );
+    test<true>( halfway, " halfway, " );
+}
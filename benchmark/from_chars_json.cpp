@@ -0,0 +1,158 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses doubles that must be JSON numbers, once by checking the grammar of RFC 8259 in a scan of their own and then
+// calling from_chars, and once with from_chars and chars_format::json. Against from_chars with no check at all.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static std::vector<std::string> data;
+
+static BOOST_NOINLINE void init_input_data()
+{
+    boost::detail::splitmix64 rng;
+
+    char buffer[ 64 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) || i % 2 == 0 )
+        {
+            x = static_cast<double>( tmp % 1000000 ) / 1000;
+        }
+
+        data.emplace_back( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr );
+    }
+}
+
+static bool is_digit( char c )
+{
+    return c >= '0' && c <= '9';
+}
+
+// The end of the JSON number at p, or nullptr
+static char const* validate_json_number( char const* p, char const* last )
+{
+    if( p != last && *p == '-' ) ++p;
+
+    if( p == last || !is_digit( *p ) ) return nullptr;
+    if( *p == '0' && p + 1 != last && is_digit( p[1] ) ) return nullptr;
+    while( p != last && is_digit( *p ) ) ++p;
+
+    if( p != last && *p == '.' )
+    {
+        ++p;
+        if( p == last || !is_digit( *p ) ) return nullptr;
+        while( p != last && is_digit( *p ) ) ++p;
+    }
+
+    if( p != last && ( *p == 'e' || *p == 'E' ) )
+    {
+        ++p;
+        if( p != last && ( *p == '+' || *p == '-' ) ) ++p;
+        if( p == last || !is_digit( *p ) ) return nullptr;
+        while( p != last && is_digit( *p ) ) ++p;
+    }
+
+    return p;
+}
+
+static BOOST_NOINLINE void test_from_chars()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            double x = 0;
+            boost::charconv::from_chars( str.data(), str.data() + str.size(), x );
+            s += x > 0;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "           from_chars: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_validate_then_from_chars()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            char const* first = str.data();
+            char const* last = first + str.size();
+
+            double x = 0;
+            if( validate_json_number( first, last ) != nullptr )
+            {
+                boost::charconv::from_chars( first, last, x );
+            }
+            s += x > 0;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "validate + from_chars: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars_json()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            double x = 0;
+            boost::charconv::from_chars( str.data(), str.data() + str.size(), x, boost::charconv::chars_format::json );
+            s += x > 0;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "     from_chars, json: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    init_input_data();
+
+    test_from_chars();
+    test_validate_then_from_chars();
+    test_from_chars_json();
+}
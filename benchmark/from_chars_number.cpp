@@ -0,0 +1,138 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses a mix of integers and doubles, as found in JSON documents, once by scanning each number for a fraction or
+// an exponent and then calling from_chars for the type, and once with from_chars_number.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static std::vector<std::string> data;
+
+static BOOST_NOINLINE void init_input_data()
+{
+    boost::detail::splitmix64 rng;
+
+    char buffer[ 64 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        if( i % 2 == 0 )
+        {
+            // Ids and counts
+            std::int64_t x = static_cast<std::int64_t>( tmp >> ( tmp % 64 ) );
+            data.emplace_back( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr );
+        }
+        else
+        {
+            double x;
+            std::memcpy( &x, &tmp, sizeof(x) );
+
+            if( !std::isfinite(x) || i % 4 == 1 )
+            {
+                x = static_cast<double>( tmp % 1000000 ) / 1000;
+            }
+
+            data.emplace_back( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr );
+        }
+    }
+}
+
+static BOOST_NOINLINE void test_two_scans()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            char const* first = str.data();
+            char const* last = first + str.size();
+
+            char const* p = first + ( *first == '-' );
+            while( p != last && *p >= '0' && *p <= '9' ) ++p;
+
+            bool is_double = p != last && ( *p == '.' || *p == 'e' || *p == 'E' );
+
+            if( !is_double )
+            {
+                std::int64_t x;
+                if( boost::charconv::from_chars( first, last, x ) )
+                {
+                    s += static_cast<std::uint64_t>( x );
+                    continue;
+                }
+
+                std::uint64_t y;
+                if( boost::charconv::from_chars( first, last, y ) )
+                {
+                    s += y;
+                    continue;
+                }
+            }
+
+            double x;
+            boost::charconv::from_chars( first, last, x );
+            s += x > 0;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  from_chars by type: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_from_chars_number()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( auto const& str: data )
+        {
+            boost::charconv::number x;
+            boost::charconv::from_chars_number( str.data(), str.data() + str.size(), x );
+
+            switch( x.kind )
+            {
+                case boost::charconv::number_kind::int64: s += static_cast<std::uint64_t>( x.int64 ); break;
+                case boost::charconv::number_kind::uint64: s += x.uint64; break;
+                case boost::charconv::number_kind::double_: s += x.double_ > 0; break;
+            }
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  from_chars_number: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    init_input_data();
+
+    test_two_scans();
+    test_from_chars_number();
+}
@@ -0,0 +1,125 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses numbers from a buffer with slack at the end, once with from_chars and once with from_chars_padded
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+// Offsets of the numbers in text, each followed by a space
+template <typename T>
+static BOOST_NOINLINE void init_input_data( std::string& text, std::vector<std::size_t>& offsets, bool short_values )
+{
+    boost::detail::splitmix64 rng;
+    char buffer[ 64 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+        T x;
+
+        if( short_values )
+        {
+            x = static_cast<T>( tmp % 100000 );
+        }
+        else
+        {
+            std::memcpy( &x, &tmp, sizeof(x) );
+        }
+
+        BOOST_IF_CONSTEXPR( std::is_floating_point<T>::value )
+        {
+            if( !std::isfinite( x ) ) continue;
+
+            if( short_values )
+            {
+                x = static_cast<T>( random_reading( tmp ) );
+            }
+        }
+
+        offsets.push_back( text.size() );
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        text.append( buffer, r.ptr );
+        text += ' ';
+    }
+
+    offsets.push_back( text.size() );
+    text.append( boost::charconv::from_chars_padding, ' ' );
+}
+
+template <bool Padded, typename T>
+static BOOST_NOINLINE void test( std::string const& text, std::vector<std::size_t> const& offsets, char const* label, char const* type )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    T s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j + 1 < offsets.size(); ++j )
+        {
+            char const* first = text.data() + offsets[ j ];
+            char const* last = text.data() + offsets[ j + 1 ] - 1;
+            T x = 0;
+
+            BOOST_IF_CONSTEXPR( Padded )
+            {
+                boost::charconv::from_chars_padded( first, last, x );
+            }
+            else
+            {
+                boost::charconv::from_chars( first, last, x );
+            }
+
+            s = static_cast<T>( s + x );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 17 ) << ( Padded ? "from_chars_padded" : "from_chars" ) << "<" << type << ">, " << label << ": "
+              << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+template <typename T>
+static void test( char const* type )
+{
+    for( bool short_values: { false, true } )
+    {
+        std::string text;
+        std::vector<std::size_t> offsets;
+        init_input_data<T>( text, offsets, short_values );
+
+        char const* label = short_values ? "short " : "random";
+
+        test<false, T>( text, offsets, label, type );
+        test<true, T>( text, offsets, label, type );
+
+        std::cout << std::endl;
+    }
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    test<double>( "double" );
+    test<float>( "float" );
+    test<std::uint64_t>( "std::uint64_t" );
+    test<std::int32_t>( "std::int32_t" );
+}
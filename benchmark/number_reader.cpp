@@ -0,0 +1,134 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Sums the values of a synthetic CSV file of doubles and integers, once read into memory and split into tokens
+// for from_chars, and once with number_reader, which maps the file and parses with from_chars_padded.
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/number_reader.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+constexpr unsigned N = 4'000'000;
+constexpr int K = 5;
+
+static char const* const path = "number_reader_benchmark.csv";
+
+// Rows of an integer id and a double reading
+static BOOST_NOINLINE void write_input_file()
+{
+    boost::detail::splitmix64 rng;
+
+    std::string text;
+    char buffer[ 64 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+        double x = random_mixed( tmp, i );
+
+        text.append( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), static_cast<int>( tmp >> 40 ) ).ptr );
+        text += ',';
+        text.append( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x ).ptr );
+        text += '\n';
+    }
+
+    std::FILE* f = std::fopen( path, "wb" );
+    std::fwrite( text.data(), 1, text.size(), f );
+    std::fclose( f );
+
+    std::cout << "File: " << text.size() / 1000000 << " MB\n\n";
+}
+
+static BOOST_NOINLINE void test_from_chars()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        std::FILE* f = std::fopen( path, "rb" );
+        std::string text;
+        char chunk[ 65536 ];
+        std::size_t n;
+        while( ( n = std::fread( chunk, 1, sizeof( chunk ), f ) ) != 0 )
+        {
+            text.append( chunk, n );
+        }
+        std::fclose( f );
+
+        char const* p = text.data();
+        char const* const last = p + text.size();
+
+        while( p != last )
+        {
+            char const* token_end = p;
+            while( token_end != last && *token_end != ',' && *token_end != '\n' ) ++token_end;
+
+            int id = 0;
+            boost::charconv::from_chars( p, token_end, id );
+            p = token_end + 1;
+
+            token_end = p;
+            while( token_end != last && *token_end != ',' && *token_end != '\n' ) ++token_end;
+
+            double x = 0;
+            boost::charconv::from_chars( p, token_end, x );
+            p = token_end == last ? last : token_end + 1;
+
+            s += id + ( x > 0 );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "   from_chars: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_number_reader()
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        boost::charconv::number_reader reader;
+        reader.open( path );
+
+        int id = 0;
+        double x = 0;
+        while( reader.read( id ) && reader.read( x ) )
+        {
+            s += id + ( x > 0 );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "number_reader: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    write_input_file();
+
+    test_from_chars();
+    test_number_reader();
+
+    std::remove( path );
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes rows of an integer id and a double reading into a growing std::string, once with to_chars into a
+// buffer that is appended when a value does not fit, and once with number_writer.
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/number_writer.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static BOOST_NOINLINE void init_input_data( std::vector<int>& ids, std::vector<double>& data )
+{
+    ids.reserve( N );
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        ids.push_back( static_cast<int>( tmp >> 40 ) );
+        data.push_back( random_mixed( tmp, i ) );
+    }
+}
+
+static BOOST_NOINLINE void test_to_chars( std::vector<int> const& ids, std::vector<double> const& data, std::string& out )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        out.clear();
+
+        char buffer[ 4096 ];
+        char* first = buffer;
+        char* const last = buffer + sizeof( buffer );
+
+        for( std::size_t j = 0; j < data.size(); ++j )
+        {
+            // Room for the separators is checked with the values
+            auto r = boost::charconv::to_chars( first, last - 1, ids[ j ] );
+            if( r.ec != std::errc() )
+            {
+                out.append( buffer, first );
+                first = buffer;
+                r = boost::charconv::to_chars( first, last - 1, ids[ j ] );
+            }
+            first = r.ptr;
+            *first++ = ',';
+
+            r = boost::charconv::to_chars( first, last - 1, data[ j ] );
+            if( r.ec != std::errc() )
+            {
+                out.append( buffer, first );
+                first = buffer;
+                r = boost::charconv::to_chars( first, last - 1, data[ j ] );
+            }
+            first = r.ptr;
+            *first++ = '\n';
+        }
+
+        out.append( buffer, first );
+        s += out.size();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "     to_chars: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static void append_to_string( void* context, char const* data, std::size_t size )
+{
+    static_cast<std::string*>( context )->append( data, size );
+}
+
+static BOOST_NOINLINE void test_number_writer( std::vector<int> const& ids, std::vector<double> const& data, std::string& out )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        out.clear();
+
+        {
+            char buffer[ 4096 ];
+            boost::charconv::number_writer writer( buffer, sizeof( buffer ), append_to_string, &out );
+
+            for( std::size_t j = 0; j < data.size(); ++j )
+            {
+                writer.write( ids[ j ] );
+                writer.put( ',' );
+                writer.write( data[ j ] );
+                writer.put( '\n' );
+            }
+
+            writer.flush();
+        }
+
+        s += out.size();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "number_writer: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::vector<int> ids;
+    std::vector<double> data;
+    init_input_data( ids, data );
+
+    std::string out;
+    out.reserve( data.size() * 36 );
+
+    test_to_chars( ids, data, out );
+    test_number_writer( ids, data, out );
+}
@@ -0,0 +1,108 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses a newline delimited dump of doubles with parallel_from_chars, with 1 to hardware_concurrency() threads,
+// against a single threaded from_chars loop.
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/parallel_from_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+
+constexpr unsigned N = 20'000'000;
+constexpr int K = 3;
+
+static BOOST_NOINLINE void init_input_data( std::string& text )
+{
+    boost::detail::splitmix64 rng;
+
+    char buffer[ 64 ];
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        text.append( buffer, boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), random_mixed( rng(), i ) ).ptr );
+        text += '\n';
+    }
+}
+
+static BOOST_NOINLINE void test_from_chars( std::string const& text )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        std::vector<double> values;
+
+        char const* p = text.data();
+        char const* const last = p + text.size();
+
+        while( p != last )
+        {
+            double x = 0;
+            p = boost::charconv::from_chars( p, last, x ).ptr + 1;
+            values.push_back( x );
+        }
+
+        s += values.size();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "           from_chars: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_parallel_from_chars( std::string const& text, unsigned threads )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        std::vector<double> values;
+        boost::charconv::parallel_from_chars( text.data(), text.data() + text.size(), values, '\n', threads );
+
+        s += values.size();
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "parallel_from_chars, " << std::setw( 2 ) << threads << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::string text;
+    init_input_data( text );
+
+    std::cout << "Input: " << text.size() / 1000000 << " MB\n\n";
+
+    test_from_chars( text );
+
+    unsigned const max_threads = std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1;
+
+    for( unsigned threads = 1; threads <= max_threads; threads *= 2 )
+    {
+        test_parallel_from_chars( text, threads );
+    }
+
+    if( ( max_threads & ( max_threads - 1 ) ) != 0 )
+    {
+        test_parallel_from_chars( text, max_threads );
+    }
+}
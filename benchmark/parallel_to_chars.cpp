@@ -0,0 +1,120 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes arrays of doubles and of 64-bit integers with parallel_to_chars, with 1 to hardware_concurrency() threads,
+// against a single to_chars_n call, or a to_chars loop for the integers, into a buffer of the largest size.
+
+#include <boost/charconv.hpp>
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+
+constexpr unsigned N = 10'000'000;
+constexpr int K = 3;
+
+static std::vector<double> doubles;
+static std::vector<std::int64_t> integers;
+
+static BOOST_NOINLINE void init_input_data()
+{
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        doubles.push_back( random_mixed( tmp, i ) );
+        integers.push_back( static_cast<std::int64_t>( tmp ) >> ( tmp % 64 ) );
+    }
+}
+
+static BOOST_NOINLINE void test_sequential( std::vector<char>& buffer )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        auto r = boost::charconv::to_chars_n( buffer.data(), buffer.data() + buffer.size(), doubles.data(), doubles.size(), boost::charconv::chars_format::general, '\n' );
+        s += static_cast<std::size_t>( r.ptr - buffer.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         to_chars_n<double>: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+
+    t1 = std::chrono::steady_clock::now();
+
+    s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* p = buffer.data();
+        char* const last = p + buffer.size();
+
+        for( std::size_t j = 0; j < integers.size(); ++j )
+        {
+            if( j != 0 ) *p++ = '\n';
+            p = boost::charconv::to_chars( p, last, integers[ j ] ).ptr;
+        }
+
+        s += static_cast<std::size_t>( p - buffer.data() );
+    }
+
+    t2 = std::chrono::steady_clock::now();
+
+    std::cout << "         to_chars<int64_t>: " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_parallel_to_chars( std::vector<T> const& values, std::vector<char>& buffer, char const* label, unsigned threads )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        auto r = boost::charconv::parallel_to_chars( buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), '\n', threads );
+        s += static_cast<std::size_t>( r.ptr - buffer.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "parallel_to_chars<" << label << ">, " << std::setw( 2 ) << threads << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    init_input_data();
+
+    std::vector<char> buffer( N * 26 );
+
+    test_sequential( buffer );
+
+    unsigned const max_threads = std::thread::hardware_concurrency() != 0 ? std::thread::hardware_concurrency() : 1;
+
+    for( unsigned threads = 1; threads <= max_threads; threads *= 2 )
+    {
+        test_parallel_to_chars( doubles, buffer, "double", threads );
+        test_parallel_to_chars( integers, buffer, "int64_t", threads );
+    }
+
+    if( ( max_threads & ( max_threads - 1 ) ) != 0 )
+    {
+        test_parallel_to_chars( doubles, buffer, "double", max_threads );
+        test_parallel_to_chars( integers, buffer, "int64_t", max_threads );
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The values of the benchmarks that format or parse many numbers at once, made from the bits of splitmix64
+
+#ifndef BOOST_CHARCONV_BENCHMARK_RANDOM_VALUES_HPP
+#define BOOST_CHARCONV_BENCHMARK_RANDOM_VALUES_HPP
+
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+// Telemetry style readings with few digits, such as 123.456, which is what logs and metric dumps mostly hold
+inline double random_reading( std::uint64_t bits )
+{
+    return static_cast<double>( bits % 1000000 ) / 1000;
+}
+
+// Any finite double, with all 17 digits and the whole range of exponents
+inline double random_double( std::uint64_t bits )
+{
+    double x;
+    std::memcpy( &x, &bits, sizeof(x) );
+
+    return std::isfinite( x ) ? x : random_reading( bits );
+}
+
+// Every other value is a reading, so that both the short and the long paths are measured
+inline double random_mixed( std::uint64_t bits, unsigned i )
+{
+    return i % 2 == 0 ? random_reading( bits ) : random_double( bits );
+}
+
+#endif // BOOST_CHARCONV_BENCHMARK_RANDOM_VALUES_HPP
@@ -0,0 +1,96 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes a column of doubles as comma separated text, once with a to_chars call per value
+// and once with a single to_chars_n call, as when dumping a table to CSV or JSON.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "random_values.hpp"
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+
+constexpr unsigned N = 2'000'000;
+constexpr int K = 10;
+
+static BOOST_NOINLINE void init_input_data( std::vector<double>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data.push_back( random_mixed( rng(), i ) );
+    }
+}
+
+static BOOST_NOINLINE void test_to_chars( std::vector<double> const& data, std::vector<char>& buffer, boost::charconv::chars_format fmt, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = buffer.data();
+        char* last = first + buffer.size();
+
+        for( std::size_t j = 0; j < data.size(); ++j )
+        {
+            if( j != 0 )
+            {
+                *first++ = ',';
+            }
+
+            first = boost::charconv::to_chars( first, last, data[ j ], fmt ).ptr;
+        }
+
+        s += static_cast<std::size_t>( first - buffer.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "    to_chars, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_to_chars_n( std::vector<double> const& data, std::vector<char>& buffer, boost::charconv::chars_format fmt, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        auto r = boost::charconv::to_chars_n( buffer.data(), buffer.data() + buffer.size(), data.data(), data.size(), fmt, ',' );
+        s += static_cast<std::size_t>( r.ptr - buffer.data() );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  to_chars_n, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / std::chrono::milliseconds( 1 ) << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::vector<double> data;
+    init_input_data( data );
+
+    std::vector<char> buffer( data.size() * 25 );
+
+    test_to_chars( data, buffer, boost::charconv::chars_format::general, "general   " );
+    test_to_chars_n( data, buffer, boost::charconv::chars_format::general, "general   " );
+
+    std::cout << std::endl;
+
+    test_to_chars( data, buffer, boost::charconv::chars_format::scientific, "scientific" );
+    test_to_chars_n( data, buffer, boost::charconv::chars_format::scientific, "scientific" );
+}
@@ -0,0 +1,121 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Compares the full and the compact dragonbox cache tables, both when the tables stay in the
+// data cache and when every conversion starts with them evicted, as happens for an occasional
+// conversion inside a larger application.
+
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+constexpr unsigned N = 2'000'000;
+constexpr unsigned N_cold = 20'000;
+constexpr std::size_t evict_size = 32 * 1024 * 1024;
+
+static BOOST_NOINLINE void init_input_data( std::vector<double>& data, unsigned n )
+{
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < n; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) || x == 0 ) continue;
+
+        data.push_back( std::fabs(x) );
+    }
+}
+
+// Streams through a buffer larger than the last level cache, so nothing of the tables is left
+static BOOST_NOINLINE std::size_t evict( std::vector<unsigned char>& buffer )
+{
+    std::size_t s = 0;
+
+    for( std::size_t i = 0; i < buffer.size(); i += 64 )
+    {
+        buffer[ i ] = static_cast<unsigned char>( buffer[ i ] + 1 );
+        s += buffer[ i ];
+    }
+
+    return s;
+}
+
+template<class Policy> static BOOST_NOINLINE void test_warm( std::vector<double> const& data, Policy policy, char const* label )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::uint64_t s = 0;
+
+    for( auto x: data )
+    {
+        auto r = boost::charconv::detail::to_decimal( x, policy );
+        s += r.significand;
+        s += static_cast<std::uint64_t>( r.exponent );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "warm, " << label << ": " << std::setw( 7 ) << std::fixed << std::setprecision( 2 )
+              << std::chrono::duration<double, std::nano>( t2 - t1 ).count() / static_cast<double>( data.size() ) << " ns per call (s=" << s << ")\n";
+}
+
+template<class Policy> static BOOST_NOINLINE void test_cold( std::vector<double> const& data, std::vector<unsigned char>& buffer, Policy policy, char const* label )
+{
+    std::chrono::steady_clock::duration total {};
+
+    std::uint64_t s = 0;
+
+    for( auto x: data )
+    {
+        s += evict( buffer );
+
+        auto t1 = std::chrono::steady_clock::now();
+
+        auto r = boost::charconv::detail::to_decimal( x, policy );
+
+        auto t2 = std::chrono::steady_clock::now();
+
+        s += r.significand;
+        s += static_cast<std::uint64_t>( r.exponent );
+        total += t2 - t1;
+    }
+
+    std::cout << "cold, " << label << ": " << std::setw( 7 ) << std::fixed << std::setprecision( 2 )
+              << std::chrono::duration<double, std::nano>( total ).count() / static_cast<double>( data.size() ) << " ns per call (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::vector<double> data;
+    init_input_data( data, N );
+
+    test_warm( data, boost::charconv::detail::policy::cache::full, "full   " );
+    test_warm( data, boost::charconv::detail::policy::cache::compact, "compact" );
+
+    std::cout << std::endl;
+
+    std::vector<double> cold_data;
+    init_input_data( cold_data, N_cold );
+
+    std::vector<unsigned char> buffer( evict_size );
+
+    test_cold( cold_data, buffer, boost::charconv::detail::policy::cache::full, "full   " );
+    test_cold( cold_data, buffer, boost::charconv::detail::policy::cache::compact, "compact" );
+}
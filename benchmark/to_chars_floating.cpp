@@ -21,10 +21,12 @@ std::ostream& operator<<( std::ostream& os, std::float128_t v)
 
 
 #include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/detail/dragonbox/floff.hpp>
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
 #include <type_traits>
+#include <vector>
 #include <chrono>
 #include <cstdio>
 #include <iostream>
@@ -170,6 +172,132 @@ template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T>
     std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
 }
 
+// Fixed formatting with a small precision is mostly used for values like prices and measurements
+template<class T> static BOOST_NOINLINE void init_fixed_input_data( std::vector<T>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        data.push_back( static_cast<T>( rng() % 100000000 ) / static_cast<T>( 1000 ) );
+    }
+}
+
+template<class T> static BOOST_NOINLINE void test_snprintf_fixed( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = std::snprintf( buffer, sizeof( buffer ), "%.*f", precision, x );
+            s += r;
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">, fixed, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_std_to_chars_fixed( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = std::to_chars( buffer, buffer + sizeof( buffer ), x, std::chars_format::fixed, precision );
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "            std::to_chars<" << boost::core::type_name<T>() << ">, fixed, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+// The general path that was used for every precision before the fixed fast path
+template<class T> static BOOST_NOINLINE void test_floff_fixed( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::detail::floff<boost::charconv::detail::main_cache_full, boost::charconv::detail::extended_cache_long>(
+                x, precision, buffer, buffer + sizeof( buffer ), boost::charconv::chars_format::fixed );
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "               floff<" << boost::core::type_name<T>() << ">, fixed, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_boost_to_chars_fixed( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::fixed, precision );
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, fixed, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test_fixed()
+{
+    std::vector<T> data;
+    init_fixed_input_data( data );
+
+    for( int precision: { 2, 6 } )
+    {
+        test_snprintf_fixed( data, precision );
+        test_std_to_chars_fixed( data, precision );
+        test_floff_fixed( data, precision );
+        test_boost_to_chars_fixed( data, precision );
+
+        std::cout << std::endl;
+    }
+}
+
 template<class T> static void test()
 {
     std::vector<T> data;
@@ -235,6 +363,7 @@ int main()
 
     test<float>();
     test<double>();
+    test_fixed<double>();
     #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
     test<std::float128_t>();
     #endif
@@ -8,5 +8,11 @@
 #include <boost/charconv/from_chars.hpp>
 #include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/limits.hpp>
+#include <boost/charconv/decimal_parts.hpp>
+#include <boost/charconv/number.hpp>
+#include <boost/charconv/digit_generator.hpp>
+#include <boost/charconv/number_reader.hpp>
+#include <boost/charconv/number_writer.hpp>
+#include <boost/charconv/stats.hpp>
 
 #endif // #ifndef BOOST_CHARCONV_HPP_INCLUDED
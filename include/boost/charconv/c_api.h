@@ -0,0 +1,56 @@
+/* Copyright 2024 Matt Borland
+ * Distributed under the Boost Software License, Version 1.0.
+ * https://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef BOOST_CHARCONV_C_API_H
+#define BOOST_CHARCONV_C_API_H
+
+/* Locale independent replacements for strtod, strtoll and snprintf("%.17g") that can be called from C,
+ * and through C based foreign function interfaces. They are implemented by the boost_charconv_c library
+ * on top of from_chars and to_chars. This header must stay valid C99. */
+
+#include <stddef.h>
+
+#if defined(BOOST_ALL_DYN_LINK) || defined(BOOST_CHARCONV_DYN_LINK)
+#  if defined(_WIN32) || defined(__CYGWIN__)
+#    if defined(BOOST_CHARCONV_C_SOURCE)
+#      define BOOST_CHARCONV_C_DECL __declspec(dllexport)
+#    else
+#      define BOOST_CHARCONV_C_DECL __declspec(dllimport)
+#    endif
+#  elif defined(__GNUC__)
+#    define BOOST_CHARCONV_C_DECL __attribute__((visibility("default")))
+#  else
+#    define BOOST_CHARCONV_C_DECL
+#  endif
+#else
+#  define BOOST_CHARCONV_C_DECL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Same as strtod in the "C" locale: leading white space is skipped, and decimal and hexadecimal (0x) values,
+ * infinity and nan are accepted. On overflow or underflow to zero errno is set to ERANGE, and +-HUGE_VAL or +-0 is returned.
+ * As with glibc ERANGE is also set when the result is subnormal and not exactly the value of the input. */
+BOOST_CHARCONV_C_DECL double bc_strtod(const char* str, char** endptr);
+
+/* Same as strtoll: base is 0 or 2 to 36, and with base 0 the prefix selects between base 8 (0), 16 (0x), and 10.
+ * On overflow errno is set to ERANGE and LLONG_MIN or LLONG_MAX is returned, and an invalid base sets errno to EINVAL. */
+BOOST_CHARCONV_C_DECL long long bc_strtoll(const char* str, char** endptr, int base);
+
+/* Write the shortest representation of value that reads back to the same value, e.g. 0.1 instead of the
+ * 0.10000000000000001 of "%.17g". Like snprintf at most size - 1 characters and a terminating '\0' are written,
+ * and the return value is the length of the full output. */
+BOOST_CHARCONV_C_DECL int bc_dtoa_shortest(char* buffer, size_t size, double value);
+
+/* Same as snprintf(buffer, size, "%.*g", precision, value) in the "C" locale */
+BOOST_CHARCONV_C_DECL int bc_dtoa_precision(char* buffer, size_t size, double value, int precision);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOST_CHARCONV_C_API_H */
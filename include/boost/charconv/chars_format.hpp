@@ -14,7 +14,12 @@ enum class chars_format : unsigned
     scientific = 1 << 0,
     fixed = 1 << 1,
     hex = 1 << 2,
-    general = fixed | scientific
+    general = fixed | scientific,
+
+    // from_chars accepts only the number grammar of RFC 8259 (JSON): no leading '+', no leading zeros,
+    // at least one digit before and after the '.', digits after the 'e', and no inf, nan or hex.
+    // to_chars treats it as general.
+    json = 1 << 3 | general
 };
 
 }} // Namespaces
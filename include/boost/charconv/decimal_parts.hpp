@@ -0,0 +1,51 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DECIMAL_PARTS_HPP_INCLUDED
+#define BOOST_CHARCONV_DECIMAL_PARTS_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// Exact decimal decomposition of a number: (-1)^sign * significand * 10^exponent
+//
+// digits is the number of significant decimal digits (zero has none).
+// truncated is set when non-zero digits had to be dropped because they do not fit into
+// Unsigned_Integer, in which case significand holds the leading digits and exponent is
+// adjusted so that the value is the input rounded toward zero.
+template <typename Unsigned_Integer>
+struct decimal_parts
+{
+    Unsigned_Integer significand;
+    std::int64_t exponent;
+    int digits;
+    bool sign;
+    bool truncated;
+};
+
+// Splits a decimal string into its parts without converting to binary.
+// Accepts the same grammar as from_chars for floating point types, except that hex, inf, and nan are rejected
+BOOST_CHARCONV_DECL from_chars_result parse_decimal(const char* first, const char* last, decimal_parts<std::uint64_t>& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result parse_decimal(boost::core::string_view sv, decimal_parts<std::uint64_t>& value, chars_format fmt = chars_format::general) noexcept;
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_DECL from_chars_result parse_decimal(const char* first, const char* last, decimal_parts<boost::uint128_type>& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result parse_decimal(boost::core::string_view sv, decimal_parts<boost::uint128_type>& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+// Shortest decimal representation that round-trips to value (the same digits to_chars prints).
+// Returns std::errc::invalid_argument and leaves parts untouched for inf and nan
+BOOST_CHARCONV_DECL std::errc to_decimal(float value, decimal_parts<std::uint64_t>& parts) noexcept;
+BOOST_CHARCONV_DECL std::errc to_decimal(double value, decimal_parts<std::uint64_t>& parts) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DECIMAL_PARTS_HPP_INCLUDED
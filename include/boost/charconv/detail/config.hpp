@@ -75,6 +75,15 @@
 #  endif
 #endif
 
+#if defined(__cpp_char8_t) && __cpp_char8_t >= 201811L
+#  define BOOST_CHARCONV_HAS_CHAR8_T
+#endif
+
+// SSE2 is part of x86-64, and optional for 32-bit x86
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define BOOST_CHARCONV_HAS_SSE2
+#endif
+
 static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BYTE) &&
              !(BOOST_CHARCONV_ENDIAN_BIG_BYTE && BOOST_CHARCONV_ENDIAN_LITTLE_BYTE),
 "Inconsistent endianness detected. Please file an issue at https://github.com/cppalliance/charconv with your architecture");
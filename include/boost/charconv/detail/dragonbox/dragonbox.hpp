@@ -1457,6 +1457,37 @@ namespace cache {
             return cache_format::cache[std::size_t(k - cache_format::min_k)];
         }
     };
+
+    // Recovers the binary64 entries from every 27th entry and a 2 bit correction per entry,
+    // which is less than 1 KB of tables instead of 10 KB. The binary32 table is small enough to be used as is.
+    struct compact : base
+    {
+        using cache_policy = compact;
+
+        static constexpr cache_holder_ieee754_binary32::cache_entry_type get_cache_impl(int k, std::true_type) noexcept
+        {
+            return full::get_cache<ieee754_binary32>(k);
+        }
+
+        static cache_holder_ieee754_binary64::cache_entry_type get_cache_impl(int k, std::false_type) noexcept
+        {
+            return compressed_cache_detail::get_cache(k);
+        }
+
+        template <typename FloatFormat>
+        static auto get_cache(int k) noexcept
+            -> decltype(get_cache_impl(k, std::is_same<FloatFormat, ieee754_binary32>{}))
+        {
+            return get_cache_impl(k, std::is_same<FloatFormat, ieee754_binary32>{});
+        }
+    };
+
+    // The cache used when no cache policy is requested
+    #ifdef BOOST_CHARCONV_DRAGONBOX_COMPACT_CACHE
+    using default_cache = compact;
+    #else
+    using default_cache = full;
+    #endif
 }
 }
 
@@ -1522,6 +1553,7 @@ namespace binary_to_decimal_rounding {
 
 namespace cache {
     BOOST_INLINE_VARIABLE constexpr auto full = detail::policy_impl::cache::full{};
+    BOOST_INLINE_VARIABLE constexpr auto compact = detail::policy_impl::cache::compact{};
 }
 } // Namespace Policy
 
@@ -2402,7 +2434,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
     
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2413,7 +2445,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -2591,13 +2623,19 @@ namespace to_chars_detail {
             }
             else 
             {
+                // The sign may already have taken the only character there was
                 if (fmt != chars_format::scientific)
                 {
+                    if (buffer == last)
+                    {
+                        return {last, std::errc::value_too_large};
+                    }
+
                     std::memcpy(buffer, "0", 1); // NOLINT: Specifically not null-terminated
                     return {buffer + 1, std::errc()};
                 }
 
-                if (buffer_size >= 5)
+                if (last - buffer >= 5)
                 {
                     std::memcpy(buffer, "0e+00", 5); // NOLINT: Specifically not null-terminated
                     return {buffer + 5, std::errc()};
@@ -2717,7 +2755,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
 
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2728,7 +2766,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
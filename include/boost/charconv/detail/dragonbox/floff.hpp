@@ -820,47 +820,7 @@ struct main_cache_compressed
 
         BOOST_IF_CONSTEXPR (std::is_same<FloatFormat, ieee754_binary64>::value) 
         {
-            // Compute the base index.
-            const auto cache_index =
-                static_cast<int>(static_cast<std::uint32_t>(k - main_cache_holder::min_k) /
-                    compressed_cache_detail::compression_ratio);
-
-            const auto kb = cache_index * compressed_cache_detail::compression_ratio +
-                            main_cache_holder::min_k;
-
-            const auto offset = k - kb;
-
-            // Get the base cache.
-            const auto base_cache = compressed_cache_detail::cache_holder_t::table[cache_index];
-
-            if (offset == 0)
-            {
-                return base_cache;
-            }
-            else 
-            {
-
-                // Compute the required amount of bit-shift.
-                const auto alpha = log::floor_log2_pow10(kb + offset) - log::floor_log2_pow10(kb) - offset;
-                BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
-
-                // Try to recover the real cache.
-                const auto pow5 = compressed_cache_detail::pow5_holder_t::table[offset];
-                auto recovered_cache = umul128(base_cache.high, pow5);
-                const auto middle_low = umul128(base_cache.low, pow5);
-
-                recovered_cache += middle_low.high;
-
-                const auto high_to_middle = recovered_cache.high << (64 - alpha);
-                const auto middle_to_low = recovered_cache.low << (64 - alpha);
-
-                recovered_cache = uint128{(recovered_cache.low >> alpha) | high_to_middle, ((middle_low.low >> alpha) | middle_to_low)};
-
-                BOOST_CHARCONV_ASSERT(recovered_cache.low + 1 != 0);
-                recovered_cache = uint128(recovered_cache.high, recovered_cache.low + 1);
-
-                return recovered_cache;
-            }
+            return compressed_cache_detail::get_cache(k);
         }
         else
         {
@@ -1027,7 +987,8 @@ template <bool b> constexpr typename extended_cache_long_impl<b>::multiplier_ind
 
 using extended_cache_long = extended_cache_long_impl<true>;
 
-struct extended_cache_compact 
+template <bool b>
+struct extended_cache_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 6;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1096,23 +1057,27 @@ struct extended_cache_compact
         0x61, 0x45, 0x23, 0x41, 0x23, 0x31, 0x12, 0x12, 0x01};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
 
-constexpr std::size_t extended_cache_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_compact::cache_bits_unit;
-constexpr int extended_cache_compact::segment_length;
-constexpr bool extended_cache_compact::constant_block_count;
-constexpr int extended_cache_compact::collapse_factor;
-constexpr int extended_cache_compact::e_min;
-constexpr int extended_cache_compact::k_min;
-constexpr int extended_cache_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_compact::cache_block_count_offset_base;
-constexpr extended_cache_compact::multiplier_index_info extended_cache_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_compact::cache_block_counts[];
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_compact_impl<b>::multiplier_index_info extended_cache_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_compact_impl<b>::cache_block_counts[];
 
 #endif
 
-struct extended_cache_super_compact 
+using extended_cache_compact = extended_cache_compact_impl<true>;
+
+template <bool b>
+struct extended_cache_super_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 15;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1159,23 +1124,36 @@ struct extended_cache_super_compact
                                                             0x24, 0x8a, 0x46, 0x62, 0x24, 0x13};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
-
-constexpr std::size_t extended_cache_super_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_super_compact::cache_bits_unit;
-constexpr int extended_cache_super_compact::segment_length;
-constexpr bool extended_cache_super_compact::constant_block_count;
-constexpr int extended_cache_super_compact::collapse_factor;
-constexpr int extended_cache_super_compact::e_min;
-constexpr int extended_cache_super_compact::k_min;
-constexpr int extended_cache_super_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_super_compact::cache_block_count_offset_base;
-constexpr std::uint64_t extended_cache_super_compact::cache[];
-constexpr extended_cache_super_compact::multiplier_index_info extended_cache_super_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_super_compact::cache_block_counts[];
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_super_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_super_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_super_compact_impl<b>::multiplier_index_info extended_cache_super_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_super_compact_impl<b>::cache_block_counts[];
 
 #endif
 
+using extended_cache_super_compact = extended_cache_super_compact_impl<true>;
+
+// The caches used for formatting with a precision. The compact configuration needs about 1.3 KB of tables
+// instead of 13 KB, at the cost of recovering the main cache entry and of longer multiplications per segment.
+// extended_cache_compact is not an option, since only segments of 22 and 252 digits are implemented below.
+#ifdef BOOST_CHARCONV_FLOFF_COMPACT_CACHE
+using floff_main_cache = main_cache_compressed;
+using floff_extended_cache = extended_cache_super_compact;
+#else
+using floff_main_cache = main_cache_full;
+using floff_extended_cache = extended_cache_long;
+#endif
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4100) // MSVC 14.0 warning of unused formal parameter is incorrect
@@ -1326,6 +1304,9 @@ template <typename MainCache = main_cache_full, typename ExtendedCache>
 BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision, char* first, char* last,
                                                  boost::charconv::chars_format fmt) noexcept
 {
+    static_assert(ExtendedCache::segment_length == 22 || ExtendedCache::segment_length == 252,
+                  "Only the extended caches with 22 or 252 digit segments are supported");
+
     if (first >= last)
     {
         return {last, std::errc::value_too_large};
@@ -1764,7 +1745,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
             const auto initial_digits = static_cast<std::uint32_t>(prod >> 32);
 
-            buffer -= (initial_digits < 10 && buffer != first ? 1 : 0);
+            buffer -= (initial_digits < 10 && buffer != buffer_starting_pos ? 1 : 0);
             remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
 
             // Avoid the situation where we have a leading 0 that we don't need
@@ -2477,7 +2458,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                             if (check_rounding_condition_with_next_bit(
                                     current_digits, segment_boundary_rounding_bit,
-                                    has_further_digits<0, 1, ExtendedCache>(significand, exp2_base, k, uconst0, uconst1)))
+                                    has_further_digits<0, 0, ExtendedCache>(significand, exp2_base, k, uconst0, uconst0)))
                             {
                                 goto round_up_two_digits;
                             }
@@ -2780,7 +2761,8 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                             BOOST_CHARCONV_ASSERT(remaining_digits >= 3);
 
-                            if (remaining_digits > 4)
+                            // The second subsegment can have up to 7 digits, so there can be more than one pair left.
+                            for (int i = 0; i < (remaining_digits - 3) / 2; ++i)
                             {
                                 prod = static_cast<std::uint32_t>(prod) * UINT64_C(100);
                                 print_2_digits(static_cast<std::uint32_t>(prod >> 32), buffer);
@@ -3327,7 +3309,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                             if (check_rounding_condition_subsegment_boundary_with_next_subsegment(
                                     current_digits,
                                     uint_with_known_number_of_digits<9>{static_cast<std::uint32_t>(second_part)},
-                                    compute_has_further_digits<1, 9, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
+                                    compute_has_further_digits<1, 0, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
                             {
                                 goto round_up_two_digits;
                             }
@@ -3653,7 +3635,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                         last_subsegment_pair >>= 1;
 
                         const auto first_part = static_cast<std::uint32_t>(last_subsegment_pair / power_of_10[9]);
-                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair) - power_of_10[9] * first_part;
+                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair - power_of_10[9] * first_part);
 
                         if (remaining_digits <= 9)
                         {
@@ -3932,6 +3914,9 @@ round_up:
     else
     {
     round_up_two_digits:
+        // current_digits always holds two digits here, but some callers arrive with an odd remaining_digits,
+        // and round_up_all_9s uses its parity to know how many digits were rounded.
+        remaining_digits &= ~1;
         if (++current_digits == 100)
         {
             goto round_up_all_9s;
@@ -4029,10 +4014,10 @@ round_up_all_9s:
                 ++decimal_dot_pos;
             }
         }
-        else if (decimal_exponent_normalized == 0 || remaining_digits == 1)
+        else
         {
             // For the case 0.99...9 -> 1.00...0, the rounded digit is one before the first digit written.
-            // This same case applies for 0.099 -> 0.10 in the precision = 2 instance
+            // This same case applies for 0.099 -> 0.10 in the precision = 2 instance, and 0.0099 -> 0.0100 in the precision = 4 instance
             // Note: decimal_exponent_normalized was negative before the increment (++decimal_exponent_normalized),
             //       so we already have printed "00" onto the buffer.
             //       Hence, --digit_starting_pos doesn't go more than the starting position of the buffer.
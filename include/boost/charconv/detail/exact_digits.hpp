@@ -0,0 +1,371 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_EXACT_DIGITS_HPP
+#define BOOST_CHARCONV_DETAIL_EXACT_DIGITS_HPP
+
+// Arbitrary precision decimal digit generation for values of the form significand * 2^e.
+// This is much slower than floff or ryu, and is only used for the inputs they do not cover,
+// but it is exact for any exponent range we support (up to binary128 subnormals).
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <climits>
+
+namespace boost {
+namespace charconv {
+namespace detail {
+
+// Number of 32-bit limbs required to hold either the integer or the fractional part
+// of a value with a 128-bit significand and binary exponent e, |e| <= max_exponent
+constexpr std::size_t exact_digits_limbs(int max_exponent) noexcept
+{
+    return static_cast<std::size_t>(max_exponent + 128) / 32U + 2U;
+}
+
+struct exact_digits_result
+{
+    // Decimal exponent of the first digit, i.e. the value is out[0].out[1]out[2]... * 10^exponent
+    int exponent;
+
+    // Set when a non-zero digit did not fit into the capacity of the output
+    bool overflow;
+};
+
+struct exact_digits_sink
+{
+    char* out;
+    int count;
+    int capacity;
+    int written;
+    int round_digit;
+    bool sticky;
+    bool tail_nonzero;
+    bool tail_non_nine;
+    bool last_odd;
+
+    // Digits past capacity are only tracked, since they are either zeros that can be dropped,
+    // 9s that a carry turns into zeros, or they make the result too long anyway
+    void push(std::uint32_t digit) noexcept
+    {
+        if (written < count)
+        {
+            if (written < capacity)
+            {
+                out[written] = static_cast<char>('0' + digit);
+            }
+            else
+            {
+                tail_nonzero = tail_nonzero || digit != 0;
+                tail_non_nine = tail_non_nine || digit != 9;
+            }
+            last_odd = (digit & 1) != 0;
+            ++written;
+        }
+        else if (round_digit < 0)
+        {
+            round_digit = static_cast<int>(digit);
+        }
+        else
+        {
+            sticky = sticky || digit != 0;
+        }
+    }
+
+    // Pushes the n lowest decimal digits of chunk, most significant first
+    void push_chunk(std::uint32_t chunk, int n) noexcept
+    {
+        char digits[9];
+        for (int i = n - 1; i >= 0; --i)
+        {
+            digits[i] = static_cast<char>(chunk % 10);
+            chunk /= 10;
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            push(static_cast<std::uint32_t>(digits[i]));
+        }
+    }
+
+    // In fixed mode the number of digits is only known once the exponent of the first one is
+    void start(int exponent, bool fixed, int precision) noexcept
+    {
+        if (fixed)
+        {
+            count = exponent + 1 + precision;
+            if (count < 0)
+            {
+                // Everything is below the rounding position, and less than half of it
+                round_digit = 0;
+                sticky = true;
+            }
+        }
+    }
+
+    bool full() const noexcept
+    {
+        return round_digit >= 0;
+    }
+};
+
+// Divides the little endian number in place by 10^9 and returns the remainder
+inline std::uint32_t exact_digits_divmod_1e9(std::uint32_t* limbs, std::size_t& size) noexcept
+{
+    std::uint64_t rem = 0;
+    for (std::size_t i = size; i-- > 0;)
+    {
+        const std::uint64_t current = (rem << 32) | limbs[i];
+        limbs[i] = static_cast<std::uint32_t>(current / UINT64_C(1000000000));
+        rem = current % UINT64_C(1000000000);
+    }
+
+    while (size > 0 && limbs[size - 1] == 0)
+    {
+        --size;
+    }
+
+    return static_cast<std::uint32_t>(rem);
+}
+
+// Writes the digits of (hi * 2^64 + lo) * 2^e to out, rounded to nearest with ties to even.
+// If fixed is false the value is rounded to count significant digits, otherwise it is rounded to count digits
+// after the decimal point and exponent + 1 + count digits are produced (none if that is not positive,
+// in which case the value rounded to zero). At most capacity digits are written to out.
+// The value must be non-zero, and |e| must not exceed the exponent max_limbs was sized for.
+template <std::size_t max_limbs>
+exact_digits_result exact_digits(std::uint64_t hi, std::uint64_t lo, int e, int count, char* out,
+                                 bool fixed = false, int capacity = INT_MAX) noexcept
+{
+    BOOST_CHARCONV_ASSERT(hi != 0 || lo != 0);
+    BOOST_CHARCONV_ASSERT(fixed ? count >= 0 : count > 0);
+
+    const int precision = count;
+    exact_digits_sink sink {out, count, capacity, 0, -1, false, false, false, false};
+    int exponent = 0;
+    bool has_fraction = false;
+
+    // The integer part is converted to 9 digit chunks, least significant first
+    {
+        std::uint32_t limbs[max_limbs] {};
+        std::size_t size = 0;
+
+        const std::uint32_t significand[4] = {static_cast<std::uint32_t>(lo), static_cast<std::uint32_t>(lo >> 32),
+                                              static_cast<std::uint32_t>(hi), static_cast<std::uint32_t>(hi >> 32)};
+
+        if (e >= 0)
+        {
+            const auto limb_shift = static_cast<std::size_t>(e) / 32U;
+            const auto bit_shift = static_cast<unsigned>(e) % 32U;
+
+            BOOST_CHARCONV_ASSERT(limb_shift + 5 <= max_limbs);
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                const std::uint64_t shifted = static_cast<std::uint64_t>(significand[i]) << bit_shift;
+                limbs[limb_shift + i] |= static_cast<std::uint32_t>(shifted);
+                limbs[limb_shift + i + 1] |= static_cast<std::uint32_t>(shifted >> 32);
+            }
+            size = limb_shift + 5;
+        }
+        else if (e > -128)
+        {
+            const auto s = static_cast<unsigned>(-e);
+            const std::uint64_t int_lo = s >= 64 ? hi >> (s - 64) : (lo >> s) | (s == 0 ? 0 : hi << (64 - s));
+            const std::uint64_t int_hi = s >= 64 ? 0 : hi >> s;
+
+            limbs[0] = static_cast<std::uint32_t>(int_lo);
+            limbs[1] = static_cast<std::uint32_t>(int_lo >> 32);
+            limbs[2] = static_cast<std::uint32_t>(int_hi);
+            limbs[3] = static_cast<std::uint32_t>(int_hi >> 32);
+            size = 4;
+        }
+
+        while (size > 0 && limbs[size - 1] == 0)
+        {
+            --size;
+        }
+
+        if (size != 0)
+        {
+            std::uint32_t chunks[max_limbs + max_limbs / 8 + 2];
+            std::size_t num_chunks = 0;
+            while (size != 0)
+            {
+                chunks[num_chunks++] = exact_digits_divmod_1e9(limbs, size);
+            }
+
+            const int top_digits = num_digits(chunks[num_chunks - 1]);
+            exponent = top_digits - 1 + 9 * static_cast<int>(num_chunks - 1);
+            sink.start(exponent, fixed, precision);
+
+            sink.push_chunk(chunks[num_chunks - 1], top_digits);
+            for (std::size_t i = num_chunks - 1; i-- > 0;)
+            {
+                if (sink.full())
+                {
+                    sink.sticky = sink.sticky || chunks[i] != 0;
+                }
+                else
+                {
+                    sink.push_chunk(chunks[i], 9);
+                }
+            }
+        }
+    }
+
+    // The fractional part is aligned so that the binary point sits on a limb boundary,
+    // then each multiplication by 10^9 shifts the next 9 digits out of the top limb
+    if (e < 0)
+    {
+        const auto s = static_cast<std::size_t>(-e);
+        const std::size_t size = (s + 31) / 32;
+        const auto pad = static_cast<unsigned>(size * 32 - s);
+        BOOST_CHARCONV_ASSERT(size + 5 <= max_limbs);
+
+        std::uint32_t limbs[max_limbs] {};
+
+        // Keep only the bits below the binary point
+        std::uint64_t frac_lo = lo;
+        std::uint64_t frac_hi = hi;
+        if (s < 64)
+        {
+            frac_lo &= (UINT64_C(1) << s) - 1;
+            frac_hi = 0;
+        }
+        else if (s < 128)
+        {
+            frac_hi &= (UINT64_C(1) << (s - 64)) - 1;
+        }
+
+        const std::uint32_t significand[4] = {static_cast<std::uint32_t>(frac_lo), static_cast<std::uint32_t>(frac_lo >> 32),
+                                              static_cast<std::uint32_t>(frac_hi), static_cast<std::uint32_t>(frac_hi >> 32)};
+
+        for (std::size_t i = 0; i < 4 && i < size; ++i)
+        {
+            const std::uint64_t shifted = static_cast<std::uint64_t>(significand[i]) << pad;
+            limbs[i] |= static_cast<std::uint32_t>(shifted);
+            if (i + 1 < size)
+            {
+                limbs[i + 1] |= static_cast<std::uint32_t>(shifted >> 32);
+            }
+        }
+
+        // Limbs below low are zero and stay zero since carries only propagate upwards
+        std::size_t low = 0;
+        while (low < size && limbs[low] == 0)
+        {
+            ++low;
+        }
+
+        bool significant = sink.written != 0;
+        int chunk_exponent = -1;
+
+        while (low < size)
+        {
+            if (sink.full())
+            {
+                has_fraction = true;
+                break;
+            }
+
+            std::uint64_t carry = 0;
+            for (std::size_t i = low; i < size; ++i)
+            {
+                const std::uint64_t current = static_cast<std::uint64_t>(limbs[i]) * UINT64_C(1000000000) + carry;
+                limbs[i] = static_cast<std::uint32_t>(current);
+                carry = current >> 32;
+            }
+            const auto chunk = static_cast<std::uint32_t>(carry);
+
+            while (low < size && limbs[low] == 0)
+            {
+                ++low;
+            }
+
+            if (significant)
+            {
+                sink.push_chunk(chunk, 9);
+            }
+            else if (chunk != 0)
+            {
+                const int chunk_digits = num_digits(chunk);
+                exponent = chunk_exponent - (9 - chunk_digits);
+                sink.start(exponent, fixed, precision);
+                sink.push_chunk(chunk, chunk_digits);
+                significant = true;
+            }
+            else if (fixed && chunk_exponent - 8 <= -(precision + 1))
+            {
+                // All the digits up to and including the rounding digit are zero
+                return {-(precision + 1), false};
+            }
+
+            chunk_exponent -= 9;
+        }
+    }
+
+    const int stored = sink.count < capacity ? sink.count : capacity;
+
+    if (!sink.full())
+    {
+        // Exact, so pad with zeros
+        if (sink.written < stored)
+        {
+            std::memset(out + sink.written, '0', static_cast<std::size_t>(stored - sink.written));
+        }
+        return {exponent, sink.tail_nonzero};
+    }
+
+    const bool sticky = sink.sticky || has_fraction;
+    const bool round_up = sink.round_digit > 5 || (sink.round_digit == 5 && (sticky || sink.last_odd));
+
+    if (!round_up)
+    {
+        return {exponent, sink.tail_nonzero};
+    }
+
+    if (sink.count > capacity && sink.tail_non_nine)
+    {
+        // Some digit past the capacity stays non-zero after rounding
+        return {exponent, true};
+    }
+
+    int i = stored - 1;
+    while (i >= 0 && out[i] == '9')
+    {
+        out[i] = '0';
+        --i;
+    }
+
+    if (i >= 0)
+    {
+        ++out[i];
+    }
+    else
+    {
+        // All the digits were 9s (or there were none in fixed mode), so the result is a power of 10
+        ++exponent;
+        if (capacity == 0)
+        {
+            return {exponent, true};
+        }
+
+        out[0] = '1';
+        if (fixed && sink.count > 0 && sink.count < capacity)
+        {
+            // Fixed gains a digit in front while keeping the ones after the decimal point
+            out[sink.count] = '0';
+        }
+    }
+
+    return {exponent, false};
+}
+
+} // namespace detail
+} // namespace charconv
+} // namespace boost
+
+#endif // BOOST_CHARCONV_DETAIL_EXACT_DIGITS_HPP
@@ -9,6 +9,7 @@
 #include <boost/charconv/detail/dragonbox/floff.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/stats.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
 #include <type_traits>
@@ -30,6 +31,8 @@ inline int print_val(char* first, std::size_t size, char* format, T value) noexc
 template <typename T>
 to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_format fmt, int precision)
 {
+    BOOST_CHARCONV_STATS_COUNT(to_chars_printf);
+
     // v % + . + num_digits(INT_MAX) + specifier + null terminator
     // 1 + 1 + 10 + 1 + 1
     char format[14] {};
@@ -76,6 +79,7 @@ to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_for
     switch (fmt)
     {
         case boost::charconv::chars_format::general:
+        case boost::charconv::chars_format::json:
             format[pos] = 'g';
             break;
 
@@ -209,6 +213,8 @@ from_chars_result from_chars_strtod_impl(const char* first, const char* last, T&
 template <typename T>
 inline from_chars_result from_chars_strtod(const char* first, const char* last, T& value) noexcept
 {
+    BOOST_CHARCONV_STATS_COUNT(from_chars_strtod);
+
     if (last - first < 1024)
     {
         char buffer[1024];
@@ -217,6 +223,7 @@ inline from_chars_result from_chars_strtod(const char* first, const char* last,
 
     // If the string to be parsed does not fit into the 1024 byte static buffer than we have to allocate a buffer.
     // malloc is used here because it does not throw on allocation failure.
+    BOOST_CHARCONV_STATS_COUNT(from_chars_strtod_malloc);
 
     char* buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(last - first + 1)));
     if (buffer == nullptr)
@@ -92,6 +92,11 @@ uint32_t parse_eight_digits_unrolled(const char32_t *)  noexcept  {
   return 0;
 }
 
+BOOST_FORCEINLINE constexpr
+uint32_t parse_eight_digits_unrolled(const wchar_t *)  noexcept  {
+  return 0;
+}
+
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 uint32_t parse_eight_digits_unrolled(const char *chars)  noexcept  {
   return parse_eight_digits_unrolled(read_u64(chars));
@@ -112,6 +117,11 @@ bool is_made_of_eight_digits_fast(const char32_t *)  noexcept  {
   return false;
 }
 
+BOOST_FORCEINLINE constexpr
+bool is_made_of_eight_digits_fast(const wchar_t *)  noexcept  {
+  return false;
+}
+
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 bool is_made_of_eight_digits_fast(const char *chars)  noexcept  {
   return is_made_of_eight_digits_fast(read_u64(chars));
@@ -133,7 +143,9 @@ using byte_span = span<char>;
 using parsed_number_string = parsed_number_string_t<char>;
 // Assuming that you use no more than 19 digits, this will
 // parse an ASCII string.
-template <typename UC>
+// With Terminated the string ends at the first '\0' and pend is not used: '\0' ends
+// every loop below on its own.
+template <typename UC, bool Terminated = false>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, parse_options_t<UC> options) noexcept {
   chars_format const fmt = options.format;
@@ -150,10 +162,11 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
 #endif
   {
     ++p;
-    if (p == pend) {
+    if (!Terminated && p == pend) {
       return answer;
     }
-    if (!is_integer(*p) && (*p != decimal_point)) { // a sign must be followed by an integer or the dot
+    // a sign must be followed by an integer or the dot, and in JSON by an integer
+    if (!is_integer(*p) && ((*p != decimal_point) || (fmt == chars_format::json))) {
       return answer;
     }
   }
@@ -161,7 +174,7 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
 
   uint64_t i = 0; // an unsigned int avoids signed overflows (which are bad)
 
-  while ((p != pend) && is_integer(*p)) {
+  while ((Terminated || p != pend) && is_integer(*p)) {
     // a multiplication by 10 is cheaper than an arbitrary integer
     // multiplication
     i = 10 * i +
@@ -170,24 +183,33 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
   }
   UC const * const end_of_integer_part = p;
   int64_t digit_count = int64_t(end_of_integer_part - start_digits);
+  if (fmt == chars_format::json) {
+    // JSON requires an integer part, without leading zeros
+    if ((digit_count == 0) || ((start_digits[0] == UC('0')) && (digit_count > 1))) {
+      return answer;
+    }
+  }
   answer.integer = span<const UC>(start_digits, size_t(digit_count));
   int64_t exponent = 0;
-  if ((p != pend) && (*p == decimal_point)) {
+  if ((Terminated || p != pend) && (*p == decimal_point)) {
     ++p;
     UC const * before = p;
     // can occur at most twice without overflowing, but let it occur more, since
     // for integers with many digits, digit parsing is the primary bottleneck.
-    if (std::is_same<UC,char>::value) {
+    if (std::is_same<UC,char>::value && !Terminated) {
       while ((std::distance(p, pend) >= 8) && is_made_of_eight_digits_fast(p)) {
         i = i * 100000000 + parse_eight_digits_unrolled(p); // in rare cases, this will overflow, but that's ok
         p += 8;
       }
     }
-    while ((p != pend) && is_integer(*p)) {
+    while ((Terminated || p != pend) && is_integer(*p)) {
       uint8_t digit = uint8_t(*p - UC('0'));
       ++p;
       i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
     }
+    if ((fmt == chars_format::json) && (p == before)) { // JSON requires digits after the dot
+      return answer;
+    }
     exponent = before - p;
     answer.fraction = span<const UC>(before, size_t(p - before));
     digit_count -= exponent;
@@ -197,25 +219,25 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     return answer;
   }
   int64_t exp_number = 0;            // explicit exponential part
-  if ((static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::scientific)) && (p != pend) && ((UC('e') == *p) || (UC('E') == *p))) {
+  if ((static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::scientific)) && (Terminated || p != pend) && ((UC('e') == *p) || (UC('E') == *p))) {
     UC const * location_of_e = p;
     ++p;
     bool neg_exp = false;
-    if ((p != pend) && (UC('-') == *p)) {
+    if ((Terminated || p != pend) && (UC('-') == *p)) {
       neg_exp = true;
       ++p;
-    } else if ((p != pend) && (UC('+') == *p)) { // '+' on exponent is allowed by C++17 20.19.3.(7.1)
+    } else if ((Terminated || p != pend) && (UC('+') == *p)) { // '+' on exponent is allowed by C++17 20.19.3.(7.1)
       ++p;
     }
-    if ((p == pend) || !is_integer(*p)) {
-      if(!(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed))) {
+    if ((!Terminated && p == pend) || !is_integer(*p)) {
+      if(!(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed)) || (fmt == chars_format::json)) {
         // We are in error.
         return answer;
       }
       // Otherwise, we will be ignoring the 'e'.
       p = location_of_e;
     } else {
-      while ((p != pend) && is_integer(*p)) {
+      while ((Terminated || p != pend) && is_integer(*p)) {
         uint8_t digit = uint8_t(*p - UC('0'));
         if (exp_number < 0x10000000) {
           exp_number = 10 * exp_number + digit;
@@ -247,7 +269,7 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     // We need to be mindful of the case where we only have zeroes...
     // E.g., 0.000000000...000.
     UC const * start = start_digits;
-    while ((start != pend) && (*start == UC('0') || *start == decimal_point)) {
+    while ((Terminated || start != pend) && (*start == UC('0') || *start == decimal_point)) {
       if(*start == UC('0')) { digit_count --; }
       start++;
     }
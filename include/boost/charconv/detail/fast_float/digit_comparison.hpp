@@ -217,6 +217,11 @@ void parse_eight_digits(const char32_t*& , limb& , size_t& , size_t& ) noexcept
   // currently unused
 }
 
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+void parse_eight_digits(const wchar_t*& , limb& , size_t& , size_t& ) noexcept {
+  // currently unused
+}
+
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 void parse_eight_digits(const char*& p, limb& value, size_t& counter, size_t& count) noexcept {
   value = value * 100000000 + parse_eight_digits_unrolled(p);
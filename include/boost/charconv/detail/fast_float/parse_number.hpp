@@ -12,6 +12,7 @@
 #include <boost/charconv/detail/fast_float/decimal_to_binary.hpp>
 #include <boost/charconv/detail/fast_float/digit_comparison.hpp>
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/stats.hpp>
 
 #include <cmath>
 #include <cstring>
@@ -150,39 +151,11 @@ BOOST_FORCEINLINE bool rounds_to_nearest() noexcept {
 
 } // namespace detail
 
+// Computes the value of a number that parse_number_string has accepted
 template<typename T, typename UC>
 BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
-                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
-  return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
-}
-
-template<typename T, typename UC>
-BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
-                                      T &value, parse_options_t<UC> options)  noexcept  {
-
-  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
-  static_assert (std::is_same<UC, char>::value ||
-                 std::is_same<UC, wchar_t>::value ||
-                 std::is_same<UC, char16_t>::value ||
-                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
-
+from_chars_result_t<UC> from_parsed_number_string(parsed_number_string_t<UC>& pns, T &value)  noexcept  {
   from_chars_result_t<UC> answer;
-#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
-  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
-    first++;
-  }
-#endif
-  if (first == last) {
-    answer.ec = std::errc::invalid_argument;
-    answer.ptr = first;
-    return answer;
-  }
-  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
-  if (!pns.valid) {
-    return detail::parse_infnan(first, last, value);
-  }
   answer.ec = std::errc(); // be optimistic
   answer.ptr = pns.lastmatch;
   // The implementation of the Clinger's fast path is convoluted because
@@ -202,6 +175,7 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
       // We have that fegetround() == FE_TONEAREST.
       // Next is Clinger's fast path.
       if (pns.mantissa <=binary_format<T>::max_mantissa_fast_path()) {
+        BOOST_CHARCONV_STATS_COUNT(from_chars_clinger);
         value = T(pns.mantissa);
         if (pns.exponent < 0) { value = value / binary_format<T>::exact_power_of_ten(-pns.exponent); }
         else { value = value * binary_format<T>::exact_power_of_ten(pns.exponent); }
@@ -219,6 +193,7 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
           return answer;
         }
 #endif
+        BOOST_CHARCONV_STATS_COUNT(from_chars_clinger);
         value = T(pns.mantissa) * binary_format<T>::exact_power_of_ten(pns.exponent);
         if (pns.negative) { value = -value; }
         return answer;
@@ -233,7 +208,12 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   }
   // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa) and we have an invalid power (am.power2 < 0),
   // then we need to go the long way around again. This is very uncommon.
-  if(am.power2 < 0) { am = digit_comp<T>(pns, am); }
+  if(am.power2 < 0) {
+    BOOST_CHARCONV_STATS_COUNT(from_chars_digit_comparison);
+    am = digit_comp<T>(pns, am);
+  } else {
+    BOOST_CHARCONV_STATS_COUNT(from_chars_eisel_lemire);
+  }
   to_float(pns.negative, am, value);
   // Test for over/underflow.
   if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
@@ -242,6 +222,47 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   return answer;
 }
 
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
+                             T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
+  return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
+}
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
+                                      T &value, parse_options_t<UC> options)  noexcept  {
+
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+  static_assert (std::is_same<UC, char>::value ||
+                 std::is_same<UC, wchar_t>::value ||
+                 std::is_same<UC, char16_t>::value ||
+                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+
+  from_chars_result_t<UC> answer;
+#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
+  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
+    first++;
+  }
+#endif
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
+  if (!pns.valid) {
+    if (options.format == chars_format::json) { // JSON has no inf or nan
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+      return answer;
+    }
+    return detail::parse_infnan(first, last, value);
+  }
+  return from_parsed_number_string(pns, value);
+}
+
 }}}} // namespace fast_float
 
 #endif
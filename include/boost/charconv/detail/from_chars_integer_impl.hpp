@@ -89,6 +89,12 @@ constexpr unsigned char digit_from_char(char val) noexcept
     return uchar_values[static_cast<unsigned char>(val)];
 }
 
+template <typename UC>
+constexpr unsigned char digit_from_char(UC val) noexcept
+{
+    return static_cast<std::uint_least32_t>(val) < 256U ? uchar_values[static_cast<unsigned char>(val)] : static_cast<unsigned char>(255);
+}
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
@@ -111,15 +117,18 @@ constexpr unsigned char digit_from_char(char val) noexcept
 
 #endif
 
-template <typename Integer, typename Unsigned_Integer>
-BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* first, const char* last, Integer& value, int base) noexcept
+// With Terminated the input ends at the first '\0' instead of at last, which is then not used. '\0' is not a digit,
+// so the digit loops stop on it without any comparisons against last.
+// With Json a leading zero may not be followed by another digit, as in the number grammar of RFC 8259.
+template <typename Integer, typename Unsigned_Integer, typename UC, bool Terminated = false, bool Json = false>
+BOOST_CXX14_CONSTEXPR from_chars_result_t<UC> from_chars_integer_impl(const UC* first, const UC* last, Integer& value, int base) noexcept
 {
     Unsigned_Integer result = 0;
     Unsigned_Integer overflow_value = 0;
     Unsigned_Integer max_digit = 0;
     
     // Check pre-conditions
-    if (!((first <= last) && (base >= 2 && base <= 36)))
+    if (!((Terminated || first <= last) && (base >= 2 && base <= 36)))
     {
         return {first, std::errc::invalid_argument};
     }
@@ -133,7 +142,7 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 
     BOOST_CHARCONV_IF_CONSTEXPR (is_signed<Integer>::value)
     {
-        if (next != last)
+        if (Terminated || next != last)
         {
             if (*next == '-')
             {
@@ -167,7 +176,7 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
     }
     else
     {
-        if (next != last && (*next == '-' || *next == '+' || *next == ' '))
+        if ((Terminated || next != last) && (*next == '-' || *next == '+' || *next == ' '))
         {
             return {first, std::errc::invalid_argument};
         }
@@ -209,14 +218,14 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
     }
 
     // If the only character was a sign abort now
-    if (next == last)
+    if (!Terminated && next == last)
     {
         return {first, std::errc::invalid_argument};
     }
 
     bool overflowed = false;
 
-    const std::ptrdiff_t nc = last - next;
+    const std::ptrdiff_t nc = Terminated ? (std::numeric_limits<std::ptrdiff_t>::max)() : last - next;
 
     // In non-GNU mode on GCC numeric limits may not be specialized
     #if defined(BOOST_CHARCONV_HAS_INT128) && !defined(__GLIBCXX_TYPE_INT_N_0)
@@ -238,6 +247,14 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
             return {first, std::errc::invalid_argument};
         }
 
+        BOOST_IF_CONSTEXPR (Json)
+        {
+            if (first_digit == 0 && (Terminated || next + 1 != last) && digit_from_char(next[1]) < unsigned_base)
+            {
+                return {first, std::errc::invalid_argument};
+            }
+        }
+
         result = static_cast<Unsigned_Integer>(result * unsigned_base + first_digit);
         ++next;
         std::ptrdiff_t i = 1;
@@ -309,16 +326,16 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 #endif
 
 // Only from_chars for integer types is constexpr (as of C++23)
-template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, int base = 10) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<UC> from_chars(const UC* first, const UC* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
 }
 
 #ifdef BOOST_CHARCONV_HAS_INT128
-template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first, const char* last, Integer& value, int base = 10) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<UC> from_chars128(const UC* first, const UC* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = boost::uint128_type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
@@ -330,6 +347,13 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first,
     return from_chars_integer_impl<uint128, uint128>(first, last, value, base);
 }
 
+// Parses the null-terminated string zstr
+template <typename Integer>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars_zstr(const char* zstr, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, make_unsigned_t<Integer>, char, true>(zstr, nullptr, value, base);
+}
+
 }}} // Namespaces
 
 #endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_INTEGER_IMPL_HPP
@@ -0,0 +1,145 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_PADDED_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_PADDED_HPP
+
+#include <boost/charconv/detail/fast_float/ascii_number.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/core/bit.hpp>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+static constexpr std::uint64_t padded_powers_of_ten[] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+    UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000)
+};
+
+// Number of decimal digits at the start of the eight characters in chars (as returned by read_u64).
+// A borrow or a carry can only misclassify the characters after the first one that is not a digit.
+BOOST_FORCEINLINE int leading_digits(std::uint64_t chars) noexcept
+{
+    const std::uint64_t non_digits = ((chars + UINT64_C(0x4646464646464646)) | (chars - UINT64_C(0x3030303030303030))) &
+                                     UINT64_C(0x8080808080808080);
+
+    return non_digits == 0 ? 8 : boost::core::countr_zero(non_digits) / 8;
+}
+
+// Value of the first count digits of chars, 1 <= count <= 8. The digits are moved to the end, which puts zeros in front
+// of them. A borrow from subtracting '0' can only reach the characters after the digits, which are shifted out.
+BOOST_FORCEINLINE std::uint64_t parse_leading_digits(std::uint64_t chars, int count) noexcept
+{
+    std::uint64_t val = (chars - UINT64_C(0x3030303030303030)) << (64 - 8 * count);
+
+    // Same steps as fast_float::parse_eight_digits_unrolled
+    constexpr std::uint64_t mask = UINT64_C(0x000000FF000000FF);
+    constexpr std::uint64_t mul1 = UINT64_C(0x000F424000000064); // 100 + (1000000ULL << 32)
+    constexpr std::uint64_t mul2 = UINT64_C(0x0000271000000001); // 1 + (10000ULL << 32)
+    val = (val * 10) + (val >> 8);
+    return (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+}
+
+// Kept out of line so that it does not take registers from the fast path
+template <typename Integer>
+BOOST_NOINLINE from_chars_result from_chars_padded_fallback(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    return from_chars_integer_impl<Integer, make_unsigned_t<Integer>>(first, last, value, base);
+}
+
+// Base 10 integers of up to 64 bits with at most 19 digits are read 8 characters at a time, with the
+// characters past last only masked out instead of checked for. Everything else takes from_chars_integer_impl.
+template <typename Integer>
+from_chars_result from_chars_padded_impl(const char* first, const char* last, Integer& value, int base) noexcept
+{
+    using Unsigned_Integer = make_unsigned_t<Integer>;
+
+    if (sizeof(Integer) > sizeof(std::uint64_t) || base != 10 || first >= last)
+    {
+        return from_chars_padded_fallback(first, last, value, base);
+    }
+
+    const char* p = first;
+    bool is_negative = false;
+    BOOST_IF_CONSTEXPR (is_signed<Integer>::value)
+    {
+        is_negative = *p == '-';
+        p += is_negative ? 1 : 0;
+    }
+
+    const char* const digits = p;
+    std::uint64_t result = 0;
+
+    for (;;)
+    {
+        const std::uint64_t chars = fast_float::read_u64(p);
+        int count = leading_digits(chars);
+        if (last - p < count)
+        {
+            count = static_cast<int>(last - p);
+        }
+
+        const std::ptrdiff_t digit_count = p - digits + count;
+        if (digit_count > 19)
+        {
+            // Longer numbers only fit with leading zeros
+            if (digit_count != 20)
+            {
+                return from_chars_padded_fallback(first, last, value, base);
+            }
+
+            // 20 digits come as 8 + 8 + 4, and fit into 64 bits up to 18446744073709551615
+            const std::uint64_t high = result * padded_powers_of_ten[count - 1] + parse_leading_digits(chars, count - 1);
+            const std::uint64_t last_digit = ((chars >> (8 * (count - 1))) & 0xFF) - '0';
+            p += count;
+            if (high > UINT64_C(1844674407370955161) || (high == UINT64_C(1844674407370955161) && last_digit > 5))
+            {
+                return {p, std::errc::result_out_of_range};
+            }
+
+            result = high * 10 + last_digit;
+            break;
+        }
+
+        if (count < 8)
+        {
+            if (count != 0)
+            {
+                result = result * padded_powers_of_ten[count] + parse_leading_digits(chars, count);
+                p += count;
+            }
+            break;
+        }
+
+        result = result * UINT64_C(100000000) + fast_float::parse_eight_digits_unrolled(chars);
+        p += 8;
+    }
+
+    if (p == digits)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const auto max_value = static_cast<std::uint64_t>((std::numeric_limits<Integer>::max)()) + (is_negative ? 1U : 0U);
+    if (result > max_value)
+    {
+        return {p, std::errc::result_out_of_range};
+    }
+
+    const auto unsigned_result = static_cast<Unsigned_Integer>(result);
+    value = static_cast<Integer>(is_negative ? static_cast<Unsigned_Integer>(0U - unsigned_result) : unsigned_result);
+
+    return {p, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_PADDED_HPP
@@ -0,0 +1,91 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_PARALLEL_FOR_EACH_INDEX_HPP
+#define BOOST_CHARCONV_DETAIL_PARALLEL_FOR_EACH_INDEX_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <system_error>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+namespace boost { namespace charconv { namespace detail {
+
+// The work is cut into chunks of about this many per thread, so that threads that get the quick chunks take more of them
+constexpr std::size_t parallel_chunks_per_thread = 16;
+
+// The number of threads for a threads argument, where 0 is one per core
+inline unsigned parallel_thread_count(unsigned threads) noexcept
+{
+    return threads != 0 ? threads : (std::max)(std::thread::hardware_concurrency(), 1U);
+}
+
+// Calls work(i) for i in [0, n), each from the first of threads threads that gets to it. The calling thread is one of them.
+// When work throws, the indices that have not started are dropped, and the first exception is rethrown by the calling
+// thread once the others are done.
+template <typename Work>
+void parallel_for_each_index(std::size_t n, unsigned threads, Work work)
+{
+    std::atomic<std::size_t> next {0};
+    std::atomic<bool> has_exception {false};
+    std::exception_ptr exception;
+
+    const auto worker = [&next, n, &work, &has_exception, &exception]() {
+        BOOST_TRY
+        {
+            for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < n; i = next.fetch_add(1, std::memory_order_relaxed))
+            {
+                work(i);
+            }
+        }
+        BOOST_CATCH (...)
+        {
+            next.store(n, std::memory_order_relaxed);
+            if (!has_exception.exchange(true))
+            {
+                exception = std::current_exception();
+            }
+        }
+        BOOST_CATCH_END
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads && t < n; ++t)
+    {
+        // The threads that could be started do all of the work
+        BOOST_TRY
+        {
+            pool.emplace_back(worker);
+        }
+        BOOST_CATCH (const std::system_error&)
+        {
+            break;
+        }
+        BOOST_CATCH_END
+    }
+
+    worker();
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    #ifndef BOOST_NO_EXCEPTIONS
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+    #endif
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_PARALLEL_FOR_EACH_INDEX_HPP
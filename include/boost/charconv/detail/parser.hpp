@@ -45,6 +45,18 @@ inline bool is_delimiter(char c, chars_format fmt) noexcept
     return !is_hex_char(c) && c != 'p' && c != 'P';
 }
 
+// Whether the exponent character at next is followed by an optional sign and a digit, which JSON requires
+inline bool has_exponent_digits(const char* next, const char* last) noexcept
+{
+    ++next;
+    if (next != last && (*next == '+' || *next == '-'))
+    {
+        ++next;
+    }
+
+    return next != last && is_integer_char(*next);
+}
+
 inline from_chars_result from_chars_dispatch(const char* first, const char* last, std::uint64_t& value, int base) noexcept
 {
     return boost::charconv::detail::from_chars(first, last, value, base);
@@ -106,6 +118,12 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
         sign = false;
     }
 
+    // JSON numbers start with a digit after the sign, which also excludes inf and nan
+    if (fmt == chars_format::json && (next == last || !is_integer_char(*next)))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
     // Handle non-finite values
     // Stl allows for string like "iNf" to return inf
     //
@@ -160,7 +178,14 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
         return {next, std::errc::invalid_argument};
     }
 
+    // JSON numbers have no leading zeros
+    if (fmt == chars_format::json && *next == '0' && next + 1 != last && is_integer_char(next[1]))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
     // Ignore leading zeros (e.g. 00005 or -002.3e+5)
+    const auto zeros_first = next;
     while (next != last && *next == '0')
     {
         ++next;
@@ -180,8 +205,34 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
         capital_exp_char = 'P';
     }
 
-    if (next == last || *next == exp_char || *next == -capital_exp_char)
+    if (next != last && (*next == exp_char || *next == capital_exp_char) && fmt == chars_format::json && !has_exponent_digits(next, last))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // The number is zero when no other digit or a dot follows the leading zeros. An exponent after them is read as
+    // for any other number, and any other character ends the number (e.g. 0e10, -0E+1, or 0 in 0-6)
+    const bool is_digit = next != last && (fmt != chars_format::hex ? is_integer_char(*next) : is_hex_char(*next));
+    if (next != zeros_first && !is_digit && (next == last || *next != '.'))
     {
+        if (next != last && (*next == exp_char || *next == capital_exp_char) && fmt != chars_format::fixed &&
+            has_exponent_digits(next, last))
+        {
+            ++next;
+            if (*next == '+' || *next == '-')
+            {
+                ++next;
+            }
+            while (next != last && is_integer_char(*next))
+            {
+                ++next;
+            }
+        }
+        else if (fmt == chars_format::scientific)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
         significand = 0;
         exponent = 0;
         return {next, std::errc()};
@@ -234,6 +285,12 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
         fractional = true;
         dot_position = i;
 
+        // JSON requires digits after the dot
+        if (fmt == chars_format::json && (next == last || !is_integer_char(*next)))
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
         // Process the fractional part if we have it
         //
         // if fmt is chars_format::scientific the e is required
@@ -271,8 +328,23 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
         // We can not process any more significant figures into the significand so skip to the end
         // or the exponent part and capture the additional orders of magnitude for the exponent
         bool found_dot = false;
+        bool json_dot = fractional;
         while (next != last && (char_validation_func(*next) || *next == '.'))
         {
+            // JSON numbers have one dot, which is followed by a digit
+            if (fmt == chars_format::json && *next == '.')
+            {
+                if (json_dot)
+                {
+                    break;
+                }
+                if (next + 1 == last || !is_integer_char(next[1]))
+                {
+                    return {first, std::errc::invalid_argument};
+                }
+                json_dot = true;
+            }
+
             ++next;
             if (!fractional && !found_dot)
             {
@@ -320,6 +392,11 @@ inline from_chars_result parser(const char* first, const char* last, bool& sign,
             return {next, std::errc::invalid_argument};
         }
 
+        if (fmt == chars_format::json && !has_exponent_digits(next, last))
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
         ++next;
         if (fmt == chars_format::fixed)
         {
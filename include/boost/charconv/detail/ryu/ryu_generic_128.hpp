@@ -430,7 +430,7 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
         const auto shift_width = (shift - result) + 1;
         memcpy(shift, ".", 1U);
         ++current_len;
-        if (current_len - shift_width > precision)
+        if (precision != -1 && current_len - shift_width > precision)
         {
             if (precision > 0)
             {
@@ -0,0 +1,38 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_STATS_HPP
+#define BOOST_CHARCONV_DETAIL_STATS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+
+// BOOST_CHARCONV_STATS_COUNT(name) adds one to the counter of stats_snapshot with that name in builds of the library
+// with BOOST_CHARCONV_ENABLE_STATS, and does nothing otherwise
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS
+
+namespace boost { namespace charconv { namespace detail {
+
+enum class stats_counter : unsigned
+{
+    from_chars_clinger,
+    from_chars_eisel_lemire,
+    from_chars_digit_comparison,
+    from_chars_strtod,
+    from_chars_strtod_malloc,
+    to_chars_printf,
+    count
+};
+
+// Only called from the sources of the library
+void count_stat(stats_counter counter) noexcept;
+
+}}} // Namespaces
+
+#  define BOOST_CHARCONV_STATS_COUNT(name) boost::charconv::detail::count_stat(boost::charconv::detail::stats_counter::name)
+#else
+#  define BOOST_CHARCONV_STATS_COUNT(name) static_cast<void>(0)
+#endif
+
+#endif // BOOST_CHARCONV_DETAIL_STATS_HPP
@@ -0,0 +1,323 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_HPP
+
+// Shortest round trip formatting for binary16 and bfloat16.
+// With at most 11 significand bits the Schubfach algorithm only needs a 64-bit approximation of the power of ten
+// and 32-bit arithmetic for everything else, which is a lot cheaper than widening the value into ryu's 128-bit path.
+// Every input of both formats is checked against the exact decimal value from exact_digits in test/to_chars_16_bit.cpp
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox_common.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstdint>
+#include <cstring>
+
+namespace boost { namespace charconv { namespace detail {
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+template <bool b>
+struct pow10_16_bit_template
+#else
+struct pow10_16_bit_table
+#endif
+{
+    static constexpr int min_exponent = -36;
+    static constexpr int max_exponent = 42;
+
+    // 10^e for e in [min_exponent, max_exponent] normalized to 64 bits, and rounded up unless exact
+    static constexpr std::uint64_t significand[] = {
+        0xaa242499697392d3, 0xd4ad2dbfc3d07788,
+        0x84ec3c97da624ab5, 0xa6274bbdd0fadd62,
+        0xcfb11ead453994bb, 0x81ceb32c4b43fcf5,
+        0xa2425ff75e14fc32, 0xcad2f7f5359a3b3f,
+        0xfd87b5f28300ca0e, 0x9e74d1b791e07e49,
+        0xc612062576589ddb, 0xf79687aed3eec552,
+        0x9abe14cd44753b53, 0xc16d9a0095928a28,
+        0xf1c90080baf72cb2, 0x971da05074da7bef,
+        0xbce5086492111aeb, 0xec1e4a7db69561a6,
+        0x9392ee8e921d5d08, 0xb877aa3236a4b44a,
+        0xe69594bec44de15c, 0x901d7cf73ab0acda,
+        0xb424dc35095cd810, 0xe12e13424bb40e14,
+        0x8cbccc096f5088cc, 0xafebff0bcb24aaff,
+        0xdbe6fecebdedd5bf, 0x89705f4136b4a598,
+        0xabcc77118461cefd, 0xd6bf94d5e57a42bd,
+        0x8637bd05af6c69b6, 0xa7c5ac471b478424,
+        0xd1b71758e219652c, 0x83126e978d4fdf3c,
+        0xa3d70a3d70a3d70b, 0xcccccccccccccccd,
+        0x8000000000000000, 0xa000000000000000,
+        0xc800000000000000, 0xfa00000000000000,
+        0x9c40000000000000, 0xc350000000000000,
+        0xf424000000000000, 0x9896800000000000,
+        0xbebc200000000000, 0xee6b280000000000,
+        0x9502f90000000000, 0xba43b74000000000,
+        0xe8d4a51000000000, 0x9184e72a00000000,
+        0xb5e620f480000000, 0xe35fa931a0000000,
+        0x8e1bc9bf04000000, 0xb1a2bc2ec5000000,
+        0xde0b6b3a76400000, 0x8ac7230489e80000,
+        0xad78ebc5ac620000, 0xd8d726b7177a8000,
+        0x878678326eac9000, 0xa968163f0a57b400,
+        0xd3c21bcecceda100, 0x84595161401484a0,
+        0xa56fa5b99019a5c8, 0xcecb8f27f4200f3a,
+        0x813f3978f8940985, 0xa18f07d736b90be6,
+        0xc9f2c9cd04674edf, 0xfc6f7c4045812297,
+        0x9dc5ada82b70b59e, 0xc5371912364ce306,
+        0xf684df56c3e01bc7, 0x9a130b963a6c115d,
+        0xc097ce7bc90715b4, 0xf0bdc21abb48db21,
+        0x96769950b50d88f5, 0xbc143fa4e250eb32,
+        0xeb194f8e1ae525fe, 0x92efd1b8d0cf37bf,
+        0xb7abc627050305ae
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr int pow10_16_bit_template<b>::min_exponent;
+template <bool b> constexpr int pow10_16_bit_template<b>::max_exponent;
+template <bool b> constexpr std::uint64_t pow10_16_bit_template<b>::significand[];
+
+#endif
+
+#if (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+using pow10_16_bit_table = pow10_16_bit_template<true>;
+
+#endif
+
+struct decimal_16_bit
+{
+    std::uint32_t significand;
+    int exponent;
+    bool is_negative;
+};
+
+// Returns g * cp / 2^64 rounded to odd, which is all the precision the interval comparisons need
+inline std::uint32_t round_to_odd_16_bit(std::uint64_t g, std::uint32_t cp) noexcept
+{
+    const std::uint64_t p = (g >> 32) * cp + (((g & UINT64_C(0xFFFFFFFF)) * cp) >> 32);
+    const auto y1 = static_cast<std::uint32_t>(p >> 32);
+    const auto y0 = static_cast<std::uint32_t>(p);
+
+    return y1 | static_cast<std::uint32_t>(y0 > 1);
+}
+
+// Returns the shortest significand * 10^exponent that rounds back to the finite value given by bits,
+// the closest one if there are several, with the trailing zeros removed from the significand.
+// Layout is one of ieee754_binary16 or brainfloat16
+template <typename Layout>
+decimal_16_bit to_decimal_16_bit(std::uint16_t bits) noexcept
+{
+    constexpr int significand_bits = Layout::significand_bits;
+
+    const bool is_negative = (bits >> 15) != 0;
+    const std::uint32_t ieee_significand = bits & ((UINT32_C(1) << significand_bits) - 1);
+    const std::uint32_t ieee_exponent = (static_cast<std::uint32_t>(bits) >> significand_bits) & ((UINT32_C(1) << Layout::exponent_bits) - 1);
+
+    std::uint32_t c;
+    int q;
+    if (ieee_exponent != 0)
+    {
+        c = (UINT32_C(1) << significand_bits) | ieee_significand;
+        q = static_cast<int>(ieee_exponent) + Layout::exponent_bias - significand_bits;
+    }
+    else
+    {
+        c = ieee_significand;
+        q = 1 + Layout::exponent_bias - significand_bits;
+    }
+
+    if (c == 0)
+    {
+        return {0, 0, is_negative};
+    }
+
+    std::uint32_t s;
+    int k;
+
+    if (q <= 0 && q > -(significand_bits + 1) && (c & ((UINT32_C(1) << -q) - 1)) == 0)
+    {
+        // Small integers are exact, and the rounding interval is too narrow to hold any other integer
+        s = c >> -q;
+        k = 0;
+    }
+    else
+    {
+        const bool is_even = (c & 1) == 0;
+        const bool lower_boundary_is_closer = ieee_significand == 0 && ieee_exponent > 1;
+
+        const std::uint32_t cbl = 4 * c - 2 + static_cast<std::uint32_t>(lower_boundary_is_closer);
+        const std::uint32_t cb = 4 * c;
+        const std::uint32_t cbr = 4 * c + 2;
+
+        k = lower_boundary_is_closer ? log::floor_log10_pow2_minus_log10_4_over_3(q) : log::floor_log10_pow2(q);
+        const int h = q + log::floor_log2_pow10(-k) + 1;
+
+        BOOST_CHARCONV_ASSERT(-k >= pow10_16_bit_table::min_exponent && -k <= pow10_16_bit_table::max_exponent);
+        const std::uint64_t g = pow10_16_bit_table::significand[-k - pow10_16_bit_table::min_exponent];
+
+        const std::uint32_t vbl = round_to_odd_16_bit(g, cbl << h);
+        const std::uint32_t vb = round_to_odd_16_bit(g, cb << h);
+        const std::uint32_t vbr = round_to_odd_16_bit(g, cbr << h);
+
+        // The boundaries themselves round back to the value only if its significand is even
+        const std::uint32_t lower = vbl + static_cast<std::uint32_t>(!is_even);
+        const std::uint32_t upper = vbr - static_cast<std::uint32_t>(!is_even);
+
+        s = vb / 4;
+
+        // One digit less is enough if exactly one of the neighbouring multiples of 10 is inside the interval
+        const std::uint32_t sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * sp + 40 <= upper;
+
+        const bool u_inside = lower <= 4 * s;
+        const bool w_inside = 4 * s + 4 <= upper;
+
+        if (s >= 10 && up_inside != wp_inside)
+        {
+            s = sp + static_cast<std::uint32_t>(wp_inside);
+            ++k;
+        }
+        else if (u_inside != w_inside)
+        {
+            s += static_cast<std::uint32_t>(w_inside);
+        }
+        else
+        {
+            // Both candidates round back to the value, so take the closer one with ties to even
+            const std::uint32_t mid = 4 * s + 2;
+            s += static_cast<std::uint32_t>(vb > mid || (vb == mid && (s & 1) != 0));
+        }
+    }
+
+    while (s % 10 == 0)
+    {
+        s /= 10;
+        ++k;
+    }
+
+    return {s, k, is_negative};
+}
+
+// Writes the value in the same layout as ryu's generic_to_chars without a precision:
+// general uses fixed when the decimal point is at most as many places away from the digits as there are digits,
+// and scientific with at least two exponent digits otherwise
+inline to_chars_result to_chars_16_bit_shortest(char* first, char* last, decimal_16_bit value, chars_format fmt) noexcept
+{
+    // Digits in reverse order
+    char digits[10];
+    int num_dig = 0;
+    std::uint32_t s = value.significand;
+    do
+    {
+        digits[num_dig++] = static_cast<char>('0' + s % 10);
+        s /= 10;
+    } while (s != 0);
+
+    bool use_fixed = fmt == chars_format::fixed;
+    if (fmt == chars_format::general)
+    {
+        const int point = value.exponent + num_dig;
+        use_fixed = point <= num_dig && -point <= num_dig;
+    }
+
+    const int sci_exponent = value.exponent + num_dig - 1;
+    const auto abs_sci_exponent = static_cast<std::uint32_t>(sci_exponent < 0 ? -sci_exponent : sci_exponent);
+
+    int total_length = static_cast<int>(value.is_negative);
+    if (!use_fixed)
+    {
+        total_length += num_dig + static_cast<int>(num_dig > 1) + 2 + (abs_sci_exponent >= 100 ? 3 : 2);
+    }
+    else if (value.exponent >= 0)
+    {
+        total_length += num_dig + value.exponent;
+    }
+    else if (-value.exponent < num_dig)
+    {
+        total_length += num_dig + 1;
+    }
+    else
+    {
+        total_length += 2 - value.exponent;
+    }
+
+    if (total_length > last - first)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (value.is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (use_fixed)
+    {
+        if (value.exponent >= 0)
+        {
+            while (num_dig > 0)
+            {
+                *first++ = digits[--num_dig];
+            }
+            std::memset(first, '0', static_cast<std::size_t>(value.exponent));
+            first += value.exponent;
+        }
+        else if (-value.exponent < num_dig)
+        {
+            const int fraction_digits = -value.exponent;
+            while (num_dig > fraction_digits)
+            {
+                *first++ = digits[--num_dig];
+            }
+            *first++ = '.';
+            while (num_dig > 0)
+            {
+                *first++ = digits[--num_dig];
+            }
+        }
+        else
+        {
+            const int leading_zeros = -value.exponent - num_dig;
+            std::memcpy(first, "0.", 2U); // NOLINT : No null terminator is purposeful
+            std::memset(first + 2, '0', static_cast<std::size_t>(leading_zeros));
+            first += 2 + leading_zeros;
+            while (num_dig > 0)
+            {
+                *first++ = digits[--num_dig];
+            }
+        }
+
+        return {first, std::errc()};
+    }
+
+    *first++ = digits[--num_dig];
+    if (num_dig > 0)
+    {
+        *first++ = '.';
+        while (num_dig > 0)
+        {
+            *first++ = digits[--num_dig];
+        }
+    }
+
+    *first++ = 'e';
+    *first++ = sci_exponent < 0 ? '-' : '+';
+    if (abs_sci_exponent >= 100)
+    {
+        *first++ = static_cast<char>('0' + abs_sci_exponent / 100);
+    }
+    *first++ = static_cast<char>('0' + abs_sci_exponent / 10 % 10);
+    *first++ = static_cast<char>('0' + abs_sci_exponent % 10);
+
+    return {first, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_HPP
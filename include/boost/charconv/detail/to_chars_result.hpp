@@ -11,23 +11,25 @@
 
 namespace boost { namespace charconv {
 
-struct to_chars_result
+template <typename UC>
+struct to_chars_result_t
 {
-    char *ptr;
+    UC* ptr;
     std::errc ec;
 
-    constexpr friend bool operator==(const to_chars_result &lhs, const to_chars_result &rhs) noexcept
+    constexpr friend bool operator==(const to_chars_result_t<UC>& lhs, const to_chars_result_t<UC>& rhs) noexcept
     {
         return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec;
     }
 
-    constexpr friend bool operator!=(const to_chars_result &lhs, const to_chars_result &rhs) noexcept
+    constexpr friend bool operator!=(const to_chars_result_t<UC>& lhs, const to_chars_result_t<UC>& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
     constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
 };
+using to_chars_result = to_chars_result_t<char>;
 
 }} // Namespaces
 
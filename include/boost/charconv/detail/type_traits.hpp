@@ -62,6 +62,39 @@ struct make_signed<boost::uint128_type> { using type = boost::int128_type; };
 
 #endif
 
+// Character types that have overloads in addition to char
+template <typename UC>
+struct is_extended_char
+{
+    static constexpr bool value = std::is_same<UC, wchar_t>::value ||
+                                  #ifdef BOOST_CHARCONV_HAS_CHAR8_T
+                                  std::is_same<UC, char8_t>::value ||
+                                  #endif
+                                  std::is_same<UC, char16_t>::value ||
+                                  std::is_same<UC, char32_t>::value;
+};
+
+// Integer types that from_chars and to_chars accept for their value, which are the same as for char
+template <typename T>
+struct is_integer_value
+{
+    static constexpr bool value = (std::is_integral<T>::value && !std::is_same<T, bool>::value && !is_extended_char<T>::value)
+                                  #ifdef BOOST_CHARCONV_HAS_INT128
+                                  || std::is_same<T, boost::int128_type>::value || std::is_same<T, boost::uint128_type>::value
+                                  #endif
+                                  ;
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <typename UC>
+constexpr bool is_extended_char<UC>::value;
+
+template <typename T>
+constexpr bool is_integer_value<T>::value;
+
+#endif
+
 }}} // Namespaces
 
 #endif //BOOST_CHARCONV_DETAIL_TYPE_TRAITS_HPP
@@ -0,0 +1,107 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DIGIT_GENERATOR_HPP_INCLUDED
+#define BOOST_CHARCONV_DIGIT_GENERATOR_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Writes the first count correctly rounded significant digits of the finite, non-negative value to first,
+// and returns the decimal exponent of the first digit. first must have room for count + 8 characters.
+BOOST_CHARCONV_DECL int generate_digits(double value, int count, char* first) noexcept;
+
+} // namespace detail
+
+struct digit_block
+{
+    std::uint32_t value;
+    int digits;
+};
+
+// Produces the decimal digits of a floating point value rounded to at most MaxDigits significant digits,
+// for callers that want to do their own layout (engineering notation, SI prefixes, padding, etc.).
+// The value is d1.d2d3... * 10^exponent(), i.e. the exponent that would be printed in scientific format.
+// Only the requested number of digits is computed, and the digits are handed out in blocks of up to 9
+// so the caller can stop as soon as it has what it needs.
+template <int MaxDigits = 17>
+class digit_generator
+{
+    static_assert(MaxDigits > 0, "At least one digit has to be generated");
+
+    // floff writes the decimal point and the exponent next to the digits
+    char buffer_[static_cast<std::size_t>(MaxDigits) + 8U];
+    int size_;
+    int pos_;
+    int exponent_;
+    bool sign_;
+
+public:
+    static constexpr int max_digits = MaxDigits;
+
+    explicit digit_generator(double value, int digits = MaxDigits) noexcept
+        : size_ {0}, pos_ {0}, exponent_ {0}, sign_ {std::signbit(value)}
+    {
+        if (!std::isfinite(value))
+        {
+            return;
+        }
+
+        size_ = digits < 1 ? 1 : digits > MaxDigits ? MaxDigits : digits;
+        exponent_ = detail::generate_digits(std::fabs(value), size_, buffer_);
+    }
+
+    // False for inf and nan, which have no digits
+    explicit operator bool() const noexcept { return size_ != 0; }
+
+    bool sign() const noexcept { return sign_; }
+    int exponent() const noexcept { return exponent_; }
+    int size() const noexcept { return size_; }
+    int remaining() const noexcept { return size_ - pos_; }
+    bool done() const noexcept { return pos_ == size_; }
+
+    // Returns the next block of up to max_block_digits (at most 9) digits as an integer
+    digit_block next(int max_block_digits = 9) noexcept
+    {
+        if (max_block_digits > 9)
+        {
+            max_block_digits = 9;
+        }
+        const int n = remaining() < max_block_digits ? remaining() : max_block_digits;
+
+        std::uint32_t value = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            value = value * 10U + static_cast<std::uint32_t>(buffer_[pos_ + i] - '0');
+        }
+        pos_ += n;
+
+        return {value, n};
+    }
+
+    // Copies up to last - first of the next digits as characters, and returns one past the last character written
+    char* next(char* first, char* last) noexcept
+    {
+        while (first < last && pos_ < size_)
+        {
+            *first++ = buffer_[pos_++];
+        }
+
+        return first;
+    }
+};
+
+template <int MaxDigits>
+constexpr int digit_generator<MaxDigits>::max_digits;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DIGIT_GENERATOR_HPP_INCLUDED
@@ -9,11 +9,16 @@
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/from_chars_padded.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <system_error>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
 
 namespace boost { namespace charconv {
 
@@ -133,6 +138,85 @@ BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_v
 }
 #endif
 
+// Base 10, or base 16 for chars_format::hex. chars_format::json also rejects leading zeros, as RFC 8259 does.
+template <typename Integer, typename std::enable_if<detail::is_integer_value<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, chars_format fmt) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+
+    if (fmt == chars_format::json)
+    {
+        return detail::from_chars_integer_impl<Integer, Unsigned_Integer, char, false, true>(first, last, value, 10);
+    }
+
+    return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, fmt == chars_format::hex ? 16 : 10);
+}
+
+template <typename Integer, typename std::enable_if<detail::is_integer_value<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(boost::core::string_view sv, Integer& value, chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+// Null-terminated strings, as an alternative to strtol and friends. The digit loops stop on the '\0' themselves,
+// so the string is only read once instead of first being measured with strlen.
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, bool& value, int base = 10) noexcept = delete;
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, char& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, signed char& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, unsigned char& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, short& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, unsigned short& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, int& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, unsigned int& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, long& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, unsigned long& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, unsigned long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, boost::int128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* zstr, boost::uint128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars_zstr(zstr, value, base);
+}
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 // Floating Point
 //----------------------------------------------------------------------------------------------------------------------
@@ -249,6 +333,81 @@ BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, st
 BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
 #endif
 
+// Null-terminated strings, as an alternative to strtof, strtod, and strtold that does not depend on the locale
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* zstr, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* zstr, double& value, chars_format fmt = chars_format::general) noexcept;
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* zstr, long double& value, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+//----------------------------------------------------------------------------------------------------------------------
+// wchar_t, char8_t, char16_t and char32_t
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename UC, typename Integer, typename std::enable_if<detail::is_extended_char<UC>::value && detail::is_integer_value<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<UC> from_chars(const UC* first, const UC* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+#ifdef BOOST_CHARCONV_HAS_CHAR8_T
+// char8_t has the same representation as char, so these need no library functions of their own
+template <typename Real, typename std::enable_if<std::is_floating_point<Real>::value, bool>::type = true>
+inline from_chars_result_t<char8_t> from_chars(const char8_t* first, const char8_t* last, Real& value, chars_format fmt = chars_format::general) noexcept
+{
+    const auto narrow_first = reinterpret_cast<const char*>(first);
+    const auto r = boost::charconv::from_chars(narrow_first, reinterpret_cast<const char*>(last), value, fmt);
+    return {first + (r.ptr - narrow_first), r.ec};
+}
+#endif
+
+// Parses n values separated by separator or line breaks (e.g. a row or a whole table of a CSV file) into values[0], ..., values[n - 1]
+// Bit i % 64 of failed[i / 64] is set when values[i] could not be parsed, failed may be nullptr or must hold (n + 63) / 64 words
+BOOST_CHARCONV_DECL from_chars_result from_chars_n(const char* first, const char* last, double* values, std::size_t n, std::uint64_t* failed = nullptr,
+                                                   chars_format fmt = chars_format::general, char separator = ',') noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Padded input
+//----------------------------------------------------------------------------------------------------------------------
+
+// Number of characters past last that from_chars_padded may read. Their values do not matter.
+constexpr std::size_t from_chars_padding = 64;
+
+// Same results as from_chars, but reads the input in whole words without checking for last first,
+// so [last, last + from_chars_padding) must be readable (e.g. slack at the end of an I/O buffer)
+template <typename Integer, typename std::enable_if<detail::is_integer_value<Integer>::value, bool>::type = true>
+inline from_chars_result from_chars_padded(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded_impl(first, last, value, base);
+}
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Approximate
+//----------------------------------------------------------------------------------------------------------------------
+
+// Same grammar and errors as from_chars, but the digits past the first 19 significant ones are dropped instead of
+// being compared with big integer arithmetic. The value is the correctly rounded one or the one next to it toward
+// zero (so at the ends of the range the largest finite value instead of an overflow, or an underflow instead of the
+// smallest subnormal), and the time taken is linear in the length of the number. chars_format::hex is not supported.
+BOOST_CHARCONV_DECL from_chars_result from_chars_fast_approx(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_fast_approx(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_fast_approx(boost::core::string_view sv, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_fast_approx(boost::core::string_view sv, double& value, chars_format fmt = chars_format::general) noexcept;
+
 } // namespace charconv
 } // namespace boost
 
@@ -0,0 +1,526 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUM_FACETS_HPP_INCLUDED
+#define BOOST_CHARCONV_NUM_FACETS_HPP_INCLUDED
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <locale>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Everything outside of ASCII ends a number
+template <typename CharT>
+inline char narrow_ascii(CharT c) noexcept
+{
+    return static_cast<typename std::make_unsigned<CharT>::type>(c) < 0x80U ? static_cast<char>(c) : '\0';
+}
+
+inline bool is_ascii_digit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+inline int ascii_digit_value(char c) noexcept
+{
+    return c >= '0' && c <= '9' ? c - '0' :
+           c >= 'a' && c <= 'z' ? c - 'a' + 10 :
+           c >= 'A' && c <= 'Z' ? c - 'A' + 10 : 36;
+}
+
+// The characters of a number read from an input iterator. Only numbers with more than 64 characters,
+// e.g. long runs of digits, need the string.
+class num_get_buffer
+{
+    char local_[64];
+    std::string long_;
+    std::size_t size_ = 0;
+
+public:
+    void push_back(char c)
+    {
+        if (size_ < sizeof(local_))
+        {
+            local_[size_] = c;
+        }
+        else
+        {
+            if (size_ == sizeof(local_))
+            {
+                long_.assign(local_, size_);
+            }
+            long_ += c;
+        }
+        ++size_;
+    }
+
+    const char* begin() const noexcept { return size_ <= sizeof(local_) ? local_ : long_.data(); }
+    const char* end() const noexcept { return begin() + size_; }
+    std::size_t size() const noexcept { return size_; }
+};
+
+// Reads one character at a time from an input iterator, as a narrow ASCII character or '\0' at the end
+template <typename InputIt>
+class num_get_reader
+{
+    InputIt& in_;
+    InputIt end_;
+    char c_;
+
+public:
+    num_get_reader(InputIt& in, InputIt end) : in_(in), end_(end), c_(in != end ? narrow_ascii(*in) : '\0') {}
+
+    char get() const noexcept { return c_; }
+
+    void next()
+    {
+        ++in_;
+        c_ = in_ != end_ ? narrow_ascii(*in_) : '\0';
+    }
+};
+
+// Characters of the length of the sign and the 0x of hexadecimal output, which internal adjustment pads after
+inline std::size_t internal_padding_position(const char* first, const char* last) noexcept
+{
+    if (first != last && (*first == '+' || *first == '-'))
+    {
+        return 1;
+    }
+    if (last - first >= 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X'))
+    {
+        return 2;
+    }
+    return 0;
+}
+
+} // namespace detail
+
+// A drop-in replacement for std::num_put that formats with to_chars. Installing it in the locale of a stream,
+// e.g. os.imbue(std::locale(os.getloc(), new boost::charconv::num_put<char>)), makes operator<< use it for all
+// arithmetic types. The output is the same as in the "C" locale: the decimal point is always '.', and digits are
+// never grouped. Hexadecimal floats (std::hexfloat) and std::showpoint are handed to std::num_put.
+template <typename CharT, typename OutputIt = std::ostreambuf_iterator<CharT>>
+class num_put : public std::num_put<CharT, OutputIt>
+{
+    using base_type = std::num_put<CharT, OutputIt>;
+
+public:
+    using char_type = CharT;
+    using iter_type = OutputIt;
+
+    explicit num_put(std::size_t refs = 0) : base_type(refs) {}
+
+protected:
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, long value) const override
+    {
+        return put_integer(out, str, fill, value);
+    }
+
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, unsigned long value) const override
+    {
+        return put_integer(out, str, fill, value);
+    }
+
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, long long value) const override
+    {
+        return put_integer(out, str, fill, value);
+    }
+
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, unsigned long long value) const override
+    {
+        return put_integer(out, str, fill, value);
+    }
+
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, double value) const override
+    {
+        return put_float(out, str, fill, value);
+    }
+
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    iter_type do_put(iter_type out, std::ios_base& str, char_type fill, long double value) const override
+    {
+        return put_float(out, str, fill, value);
+    }
+    #endif
+
+private:
+    // Writes [first, last) padded with fill to the width of the stream, and resets the width
+    static iter_type put_padded(iter_type out, std::ios_base& str, char_type fill, const char* first, const char* last)
+    {
+        const auto length = static_cast<std::streamsize>(last - first);
+        const std::streamsize padding = str.width() > length ? str.width() - length : 0;
+        str.width(0);
+
+        const auto adjustfield = str.flags() & std::ios_base::adjustfield;
+        const char* const pad_position = adjustfield == std::ios_base::left ? last :
+                                         adjustfield == std::ios_base::internal ? first + detail::internal_padding_position(first, last) :
+                                         first;
+
+        for (; first != pad_position; ++first)
+        {
+            *out = static_cast<char_type>(*first);
+            ++out;
+        }
+        for (std::streamsize i = 0; i < padding; ++i)
+        {
+            *out = fill;
+            ++out;
+        }
+        for (; first != last; ++first)
+        {
+            *out = static_cast<char_type>(*first);
+            ++out;
+        }
+
+        return out;
+    }
+
+    template <typename Integer>
+    static iter_type put_integer(iter_type out, std::ios_base& str, char_type fill, Integer value)
+    {
+        using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
+
+        const auto flags = str.flags();
+        const auto basefield = flags & std::ios_base::basefield;
+
+        // Room for the digits of base 8 and a prefix in front of them
+        char buffer[std::numeric_limits<Unsigned_Integer>::digits / 3 + 4];
+        char* const last = buffer + sizeof(buffer);
+        char* first = buffer + 2;
+
+        if (basefield == std::ios_base::oct || basefield == std::ios_base::hex)
+        {
+            // As with printf's %o and %x negative values are written as their unsigned counterparts
+            const auto unsigned_value = static_cast<Unsigned_Integer>(value);
+            const bool is_hex = basefield == std::ios_base::hex;
+            const auto r = boost::charconv::to_chars(first, last, unsigned_value, is_hex ? 16 : 8);
+            const bool uppercase = (flags & std::ios_base::uppercase) != 0;
+
+            if (is_hex && uppercase)
+            {
+                for (char* p = first; p != r.ptr; ++p)
+                {
+                    *p = *p >= 'a' ? static_cast<char>(*p - 'a' + 'A') : *p;
+                }
+            }
+
+            if ((flags & std::ios_base::showbase) != 0 && unsigned_value != 0)
+            {
+                if (is_hex)
+                {
+                    *--first = uppercase ? 'X' : 'x';
+                }
+                *--first = '0';
+            }
+
+            return put_padded(out, str, fill, first, r.ptr);
+        }
+
+        const auto r = boost::charconv::to_chars(first, last, value);
+        BOOST_IF_CONSTEXPR (std::is_signed<Integer>::value)
+        {
+            if ((flags & std::ios_base::showpos) != 0 && *first != '-')
+            {
+                *--first = '+';
+            }
+        }
+
+        return put_padded(out, str, fill, first, r.ptr);
+    }
+
+    template <typename Real>
+    iter_type put_float(iter_type out, std::ios_base& str, char_type fill, Real value) const
+    {
+        const auto flags = str.flags();
+        const auto floatfield = flags & std::ios_base::floatfield;
+
+        // Precisions in the millions are written by std::num_put as well, rather than allocated for here
+        if (floatfield == (std::ios_base::fixed | std::ios_base::scientific) || (flags & std::ios_base::showpoint) != 0 ||
+            str.precision() > 100000)
+        {
+            return base_type::do_put(out, str, fill, value);
+        }
+
+        const auto fmt = floatfield == std::ios_base::fixed ? chars_format::fixed :
+                         floatfield == std::ios_base::scientific ? chars_format::scientific : chars_format::general;
+
+        // As in printf a negative precision is taken as if it was omitted
+        const int precision = str.precision() < 0 ? 6 : static_cast<int>(str.precision());
+
+        char local_buffer[512];
+        char* first = local_buffer + 1;
+        char* last = local_buffer + sizeof(local_buffer);
+        std::string long_buffer;
+
+        if (std::isnan(value))
+        {
+            // to_chars writes nan(ind) and nan(snan), where printf writes nan
+            const char* const str_nan = std::signbit(value) ? "-nan" : "nan";
+            last = first + std::char_traits<char>::length(str_nan);
+            std::char_traits<char>::copy(first, str_nan, static_cast<std::size_t>(last - first));
+        }
+        else
+        {
+            auto r = boost::charconv::to_chars(first, last, value, fmt, precision);
+            if (r.ec == std::errc::value_too_large)
+            {
+                // Only fixed output of large values with a high precision needs more
+                long_buffer.resize(static_cast<std::size_t>(precision) + std::numeric_limits<Real>::max_exponent10 + 16U);
+                first = &long_buffer[1];
+                r = boost::charconv::to_chars(first, &long_buffer[0] + long_buffer.size(), value, fmt, precision);
+            }
+            last = r.ptr;
+        }
+
+        // Fixed output is %f, which has no uppercase form
+        if ((flags & std::ios_base::uppercase) != 0 && fmt != chars_format::fixed)
+        {
+            for (char* p = first; p != last; ++p)
+            {
+                *p = *p >= 'a' && *p <= 'z' ? static_cast<char>(*p - 'a' + 'A') : *p;
+            }
+        }
+
+        if ((flags & std::ios_base::showpos) != 0 && *first != '-')
+        {
+            *--first = '+';
+        }
+
+        return put_padded(out, str, fill, first, last);
+    }
+};
+
+// A drop-in replacement for std::num_get that parses with from_chars. Installing it in the locale of a stream
+// makes operator>> use it for all arithmetic types except bool and long double, which are left to std::num_get.
+// The results, and the characters that are taken from the stream, are the same as with std::num_get in the "C"
+// locale: a number ends at the first character that can not continue it, if the number is then incomplete
+// (e.g. "1e+") the value is 0 and failbit is set, and values out of range are clamped to the largest or smallest
+// value of the type with failbit set.
+template <typename CharT, typename InputIt = std::istreambuf_iterator<CharT>>
+class num_get : public std::num_get<CharT, InputIt>
+{
+    using base_type = std::num_get<CharT, InputIt>;
+
+public:
+    using char_type = CharT;
+    using iter_type = InputIt;
+
+    explicit num_get(std::size_t refs = 0) : base_type(refs) {}
+
+protected:
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, long& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, long long& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, unsigned short& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, unsigned int& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, unsigned long& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, unsigned long long& value) const override
+    {
+        return get_integer(in, end, str, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base&, std::ios_base::iostate& err, float& value) const override
+    {
+        return get_float(in, end, err, value);
+    }
+
+    iter_type do_get(iter_type in, iter_type end, std::ios_base&, std::ios_base::iostate& err, double& value) const override
+    {
+        return get_float(in, end, err, value);
+    }
+
+private:
+    template <typename Integer>
+    static iter_type get_integer(iter_type in, iter_type end, std::ios_base& str, std::ios_base::iostate& err, Integer& value)
+    {
+        const auto basefield = str.flags() & std::ios_base::basefield;
+        int base = basefield == std::ios_base::oct ? 8 :
+                   basefield == std::ios_base::hex ? 16 :
+                   basefield == std::ios_base::dec ? 10 : 0;
+
+        detail::num_get_reader<iter_type> reader(in, end);
+        detail::num_get_buffer digits;
+
+        const bool is_negative = reader.get() == '-';
+        if (reader.get() == '-' || reader.get() == '+')
+        {
+            reader.next();
+        }
+
+        // A 0 in front of the x of the prefix is not a digit of its own
+        bool found_zero = false;
+        if ((base == 0 || base == 16) && reader.get() == '0')
+        {
+            reader.next();
+            found_zero = true;
+            if (reader.get() == 'x' || reader.get() == 'X')
+            {
+                reader.next();
+                found_zero = false;
+                base = 16;
+            }
+            else if (base == 0)
+            {
+                base = 8;
+            }
+        }
+        else if (base == 0)
+        {
+            base = 10;
+        }
+
+        while (detail::ascii_digit_value(reader.get()) < base)
+        {
+            digits.push_back(reader.get());
+            reader.next();
+        }
+
+        // The field only holds digits, so it is always parsed to the end
+        unsigned long long magnitude = 0;
+        const auto r = boost::charconv::from_chars(digits.begin(), digits.end(), magnitude, base);
+        if (digits.size() == 0 && !found_zero)
+        {
+            value = 0;
+            err = std::ios_base::failbit;
+        }
+        else
+        {
+            using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
+            constexpr auto max_value = static_cast<unsigned long long>((std::numeric_limits<Integer>::max)());
+
+            // Signed types reach one further below zero. Unsigned types take the negative of the magnitude as strtoull does.
+            const bool is_out_of_range = r.ec == std::errc::result_out_of_range ||
+                                         magnitude > max_value + (std::is_signed<Integer>::value && is_negative ? 1U : 0U);
+            if (is_out_of_range)
+            {
+                value = std::is_signed<Integer>::value && is_negative ? (std::numeric_limits<Integer>::min)() : (std::numeric_limits<Integer>::max)();
+                err = std::ios_base::failbit;
+            }
+            else
+            {
+                const auto unsigned_value = static_cast<Unsigned_Integer>(magnitude);
+                value = static_cast<Integer>(is_negative ? static_cast<Unsigned_Integer>(0U - unsigned_value) : unsigned_value);
+            }
+        }
+
+        if (in == end)
+        {
+            err |= std::ios_base::eofbit;
+        }
+
+        return in;
+    }
+
+    template <typename Real>
+    static iter_type get_float(iter_type in, iter_type end, std::ios_base::iostate& err, Real& value)
+    {
+        detail::num_get_reader<iter_type> reader(in, end);
+        detail::num_get_buffer field;
+
+        const auto take = [&reader, &field]() {
+            field.push_back(reader.get());
+            reader.next();
+        };
+
+        if (reader.get() == '-' || reader.get() == '+')
+        {
+            take();
+        }
+
+        // The exponent only continues a number that has digits, and it is incomplete without digits of its own
+        bool found_digits = false;
+        bool is_complete = true;
+        for (; detail::is_ascii_digit(reader.get()); take())
+        {
+            found_digits = true;
+        }
+        if (reader.get() == '.')
+        {
+            take();
+            for (; detail::is_ascii_digit(reader.get()); take())
+            {
+                found_digits = true;
+            }
+        }
+        if (found_digits && (reader.get() == 'e' || reader.get() == 'E'))
+        {
+            take();
+            if (reader.get() == '-' || reader.get() == '+')
+            {
+                take();
+            }
+            is_complete = detail::is_ascii_digit(reader.get());
+            while (detail::is_ascii_digit(reader.get()))
+            {
+                take();
+            }
+        }
+
+        // from_chars does not take a + sign
+        const char* first = field.begin();
+        first += first != field.end() && *first == '+' ? 1 : 0;
+
+        Real temp_value {};
+        const auto r = boost::charconv::from_chars_erange(first, field.end(), temp_value);
+        if (!found_digits || !is_complete || r.ptr != field.end() || (r.ec != std::errc() && r.ec != std::errc::result_out_of_range))
+        {
+            value = 0;
+            err = std::ios_base::failbit;
+        }
+        else if (r.ec == std::errc::result_out_of_range && std::isinf(temp_value))
+        {
+            value = temp_value < 0 ? std::numeric_limits<Real>::lowest() : (std::numeric_limits<Real>::max)();
+            err = std::ios_base::failbit;
+        }
+        else
+        {
+            // Underflow gives 0 without an error, as strtod does
+            value = temp_value;
+        }
+
+        if (in == end)
+        {
+            err |= std::ios_base::eofbit;
+        }
+
+        return in;
+    }
+};
+
+}} // namespace boost::charconv
+
+#endif // BOOST_CHARCONV_NUM_FACETS_HPP_INCLUDED
@@ -0,0 +1,47 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUMBER_HPP_INCLUDED
+#define BOOST_CHARCONV_NUMBER_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+enum class number_kind : unsigned
+{
+    int64,
+    uint64,
+    double_
+};
+
+// A number of whichever type its text calls for, as JSON libraries store them
+struct number
+{
+    number_kind kind;
+
+    union
+    {
+        std::int64_t int64;
+        std::uint64_t uint64;
+        double double_;
+    };
+};
+
+// Parses the number at first once, and stores it as int64 when it has neither a fraction nor an exponent and fits,
+// as uint64 when it is not negative and fits only that, and as double otherwise. The result and the value are the
+// same as from from_chars for that type. On errors value is unmodified.
+// With chars_format::json the text must be a number of RFC 8259, which is checked while it is parsed.
+// chars_format::hex is not supported.
+BOOST_CHARCONV_DECL from_chars_result from_chars_number(const char* first, const char* last, number& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_number(boost::core::string_view sv, number& value, chars_format fmt = chars_format::general) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_NUMBER_HPP_INCLUDED
@@ -0,0 +1,315 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUMBER_READER_HPP_INCLUDED
+#define BOOST_CHARCONV_NUMBER_READER_HPP_INCLUDED
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <type_traits>
+#include <initializer_list>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// A whole file in memory. data is mapped when mapped is set, and allocated with std::malloc otherwise.
+// padding characters past data + size can be read, which for a mapping is the rest of the last page.
+struct file_region
+{
+    const char* data;
+    std::size_t size;
+    std::size_t padding;
+    bool mapped;
+};
+
+BOOST_CHARCONV_DECL std::error_code open_file_region(const char* path, file_region& region) noexcept;
+
+#ifdef BOOST_HAS_UNISTD_H
+BOOST_CHARCONV_DECL std::error_code open_file_region(int fd, file_region& region) noexcept;
+#endif
+
+BOOST_CHARCONV_DECL void close_file_region(file_region& region) noexcept;
+
+} // namespace detail
+
+// Reads the values of a text file, or of characters in memory, one after the other. Values are separated by white
+// space and delimiters, and comments run from the comment character to the end of the line. Each value is parsed
+// with from_chars_padded where the input has room for it, so only the last from_chars_padding characters go
+// through the checked from_chars.
+class number_reader
+{
+public:
+    number_reader() noexcept
+    {
+        set_delimiters(",");
+    }
+
+    // Reads [first, last). The padding characters past last must be readable, whatever their values.
+    number_reader(const char* first, const char* last, std::size_t padding = 0) noexcept
+    {
+        set_delimiters(",");
+        set_input(first, last, padding);
+    }
+
+    number_reader(const number_reader&) = delete;
+    number_reader& operator=(const number_reader&) = delete;
+
+    ~number_reader()
+    {
+        close();
+    }
+
+    // Maps the file where the platform supports it, and reads it into memory otherwise
+    std::error_code open(const char* path) noexcept
+    {
+        close();
+        const auto ec = detail::open_file_region(path, region_);
+        open_region(ec);
+        return ec;
+    }
+
+    #ifdef BOOST_HAS_UNISTD_H
+    // The file descriptor can be closed once open returns
+    std::error_code open(int fd) noexcept
+    {
+        close();
+        const auto ec = detail::open_file_region(fd, region_);
+        open_region(ec);
+        return ec;
+    }
+    #endif
+
+    void close() noexcept
+    {
+        if (region_.data != nullptr)
+        {
+            detail::close_file_region(region_);
+            region_ = detail::file_region {nullptr, 0, 0, false};
+        }
+
+        set_input(nullptr, nullptr, 0);
+    }
+
+    // Characters that separate values in addition to white space, "," by default.
+    // They must not be characters that appear in numbers.
+    void set_delimiters(const char* delimiters) noexcept
+    {
+        std::memset(classes_, value_class, sizeof(classes_));
+        for (const char c : {' ', '\t', '\n', '\v', '\f', '\r'})
+        {
+            classes_[static_cast<unsigned char>(c)] = separator_class;
+        }
+
+        for (; *delimiters != '\0'; ++delimiters)
+        {
+            classes_[static_cast<unsigned char>(*delimiters)] = separator_class;
+        }
+
+        if (comment_ != '\0')
+        {
+            classes_[static_cast<unsigned char>(comment_)] = comment_class;
+        }
+    }
+
+    // Starts comments that run to the end of the line, none with '\0' (the default)
+    void set_comment(char comment) noexcept
+    {
+        if (comment_ != '\0')
+        {
+            classes_[static_cast<unsigned char>(comment_)] = value_class;
+        }
+
+        comment_ = comment;
+        if (comment_ != '\0')
+        {
+            classes_[static_cast<unsigned char>(comment_)] = comment_class;
+        }
+    }
+
+    // Reads the next value, which has to be followed by a separator, a comment, or the end of the input.
+    // Returns false at the end of the input, and on errors, which leave position() at the value that
+    // could not be read. Reading stops at the first error until skip is called.
+    template <typename Integer, typename std::enable_if<detail::is_integer_value<Integer>::value, bool>::type = true>
+    bool read(Integer& value, int base = 10) noexcept
+    {
+        return read_impl(value, base);
+    }
+
+    bool read(float& value, chars_format fmt = chars_format::general) noexcept
+    {
+        return read_impl(value, fmt);
+    }
+
+    bool read(double& value, chars_format fmt = chars_format::general) noexcept
+    {
+        return read_impl(value, fmt);
+    }
+
+    // Skips the next value without reading it, and clears the error. Returns false at the end of the input.
+    bool skip() noexcept
+    {
+        error_ = std::errc();
+        const char* p = skip_separators(pos_);
+        if (p == last_)
+        {
+            pos_ = p;
+            return false;
+        }
+
+        while (p != last_ && classes_[static_cast<unsigned char>(*p)] == value_class)
+        {
+            ++p;
+        }
+
+        pos_ = p;
+        return true;
+    }
+
+    // std::errc() unless the last read failed
+    std::errc error() const noexcept
+    {
+        return error_;
+    }
+
+    bool eof() noexcept
+    {
+        pos_ = skip_separators(pos_);
+        return pos_ == last_;
+    }
+
+    const char* position() const noexcept
+    {
+        return pos_;
+    }
+
+    const char* begin() const noexcept
+    {
+        return first_;
+    }
+
+    const char* end() const noexcept
+    {
+        return last_;
+    }
+
+private:
+    static constexpr unsigned char value_class = 0;
+    static constexpr unsigned char separator_class = 1;
+    static constexpr unsigned char comment_class = 2;
+
+    void set_input(const char* first, const char* last, std::size_t padding) noexcept
+    {
+        first_ = first;
+        pos_ = first;
+        last_ = last;
+        error_ = std::errc();
+
+        // from_chars_padded reads up to from_chars_padding characters past the end that it is given,
+        // so the input is cut short by what the caller does not provide
+        const std::size_t shortfall = padding < from_chars_padding ? from_chars_padding - padding : 0;
+        padded_last_ = static_cast<std::size_t>(last - first) > shortfall ? last - shortfall : first;
+    }
+
+    void open_region(std::error_code ec) noexcept
+    {
+        if (!ec)
+        {
+            set_input(region_.data, region_.data + region_.size, region_.padding);
+        }
+    }
+
+    const char* skip_separators(const char* p) const noexcept
+    {
+        while (p != last_)
+        {
+            const unsigned char c = classes_[static_cast<unsigned char>(*p)];
+            if (c == value_class)
+            {
+                break;
+            }
+
+            if (c == comment_class)
+            {
+                const void* line_end = std::memchr(p, '\n', static_cast<std::size_t>(last_ - p));
+                p = line_end != nullptr ? static_cast<const char*>(line_end) : last_;
+                continue;
+            }
+
+            ++p;
+        }
+
+        return p;
+    }
+
+    bool ends_value(const char* p) const noexcept
+    {
+        return p == last_ || classes_[static_cast<unsigned char>(*p)] != value_class;
+    }
+
+    template <typename T, typename Arg>
+    bool read_impl(T& value, Arg arg) noexcept
+    {
+        if (error_ != std::errc())
+        {
+            return false;
+        }
+
+        const char* const p = skip_separators(pos_);
+        pos_ = p;
+        if (p == last_)
+        {
+            return false;
+        }
+
+        // A value that the cut short input ends can be longer in the whole input, and is read again,
+        // which a separator after the value rules out
+        T result {};
+        from_chars_result r {p, std::errc::invalid_argument};
+        if (p < padded_last_)
+        {
+            r = from_chars_padded(p, padded_last_, result, arg);
+        }
+
+        const bool complete = r.ec == std::errc() && (r.ptr == last_ || (r.ptr != padded_last_ && ends_value(r.ptr)));
+        if (!complete)
+        {
+            r = from_chars(p, last_, result, arg);
+            if (r.ec == std::errc() && !ends_value(r.ptr))
+            {
+                r.ec = std::errc::invalid_argument;
+            }
+        }
+
+        if (r.ec != std::errc())
+        {
+            error_ = r.ec;
+            return false;
+        }
+
+        value = result;
+        pos_ = r.ptr;
+        return true;
+    }
+
+    detail::file_region region_ {nullptr, 0, 0, false};
+    const char* first_ = nullptr;
+    const char* pos_ = nullptr;
+    const char* last_ = nullptr;
+    const char* padded_last_ = nullptr;
+    std::errc error_ = std::errc();
+    char comment_ = '\0';
+    unsigned char classes_[256];
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_NUMBER_READER_HPP_INCLUDED
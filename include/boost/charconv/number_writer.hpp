@@ -0,0 +1,276 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUMBER_WRITER_HPP_INCLUDED
+#define BOOST_CHARCONV_NUMBER_WRITER_HPP_INCLUDED
+
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/uncaught_exceptions.hpp>
+#include <type_traits>
+#include <memory>
+#include <string>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Room that the unchecked writers below need at first. It includes the scratch characters that the
+// scientific writer leaves after its output, and for fixed the 0. and 323 zeros in front of 5e-324.
+constexpr std::size_t max_shortest_chars = 33;
+constexpr std::size_t max_shortest_fixed_chars = 330;
+
+constexpr std::size_t max_shortest_chars_for(chars_format fmt) noexcept
+{
+    return fmt == chars_format::fixed ? max_shortest_fixed_chars : max_shortest_chars;
+}
+
+// Sign, precision digits, decimal point, and the exponent, or the integer part of fixed
+constexpr std::size_t max_precision_chars_for(chars_format fmt, int precision) noexcept
+{
+    return static_cast<std::size_t>(precision) + (fmt == chars_format::fixed ? max_shortest_fixed_chars : 16U);
+}
+
+// Same output as to_chars, into a buffer that has room for max_shortest_chars_for(fmt) characters,
+// or max_precision_chars_for(fmt, precision) with a non-negative precision. Returns the end of the output.
+BOOST_CHARCONV_DECL char* to_chars_unchecked(char* first, double value, chars_format fmt) noexcept;
+BOOST_CHARCONV_DECL char* to_chars_unchecked(char* first, double value, chars_format fmt, int precision) noexcept;
+
+// Longest base 10 output of the integer types
+constexpr std::size_t max_integer_chars = 40;
+
+template <typename Integer>
+constexpr std::size_t max_integer_chars_for(Integer) noexcept
+{
+    return static_cast<std::size_t>(limits<Integer>::max_chars10);
+}
+
+template <typename Integer>
+BOOST_CHARCONV_CONSTEXPR char* to_chars_unchecked(char* first, Integer value) noexcept
+{
+    return to_chars_integer_impl(first, first + max_integer_chars_for(value), value).ptr;
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+constexpr std::size_t max_integer_chars_for(boost::int128_type) noexcept
+{
+    return 38 + 2;
+}
+
+constexpr std::size_t max_integer_chars_for(boost::uint128_type) noexcept
+{
+    return 38 + 1;
+}
+
+BOOST_CHARCONV_CONSTEXPR char* to_chars_unchecked(char* first, boost::int128_type value) noexcept
+{
+    return to_chars128(first, first + max_integer_chars_for(value), value).ptr;
+}
+
+BOOST_CHARCONV_CONSTEXPR char* to_chars_unchecked(char* first, boost::uint128_type value) noexcept
+{
+    return to_chars128(first, first + max_integer_chars_for(value), value).ptr;
+}
+#endif
+
+} // namespace detail
+
+// Formats numbers into a buffer and hands the buffer to a callback when it is full. Every value makes one check
+// for the largest output of its type, instead of to_chars checking the buffer and the caller checking the result.
+// The output is the same as from to_chars with base 10, and the last of it has to be handed over with flush.
+class number_writer
+{
+public:
+    // Receives the characters written since the previous call
+    using flush_function = void (*)(void* context, const char* data, std::size_t size);
+
+    // Writes into [buffer, buffer + size), which must stay valid for the life of the writer
+    number_writer(char* buffer, std::size_t size, flush_function flush, void* context) noexcept
+        : first_(buffer), pos_(buffer), last_(buffer + size), flush_(flush), context_(context)
+    {
+    }
+
+    // Writes into a buffer of size characters that the writer allocates
+    number_writer(std::size_t size, flush_function flush, void* context)
+        : owned_(new char[size]), first_(owned_.get()), pos_(first_), last_(first_ + size), flush_(flush), context_(context)
+    {
+    }
+
+    number_writer(const number_writer&) = delete;
+    number_writer& operator=(const number_writer&) = delete;
+
+    // The callback is not called from here, where an exception from it would call std::terminate,
+    // so the output has to be flushed first. Output that is abandoned by an exception is discarded.
+    ~number_writer()
+    {
+        BOOST_CHARCONV_ASSERT_MSG(pos_ == first_ || boost::core::uncaught_exceptions() != 0,
+                                  "number_writer destroyed with output that was not flushed");
+    }
+
+    template <typename Integer, typename std::enable_if<detail::is_integer_value<Integer>::value, bool>::type = true>
+    void write(Integer value)
+    {
+        char* const first = reserve(detail::max_integer_chars_for(value));
+        if (first != nullptr)
+        {
+            pos_ = detail::to_chars_unchecked(first, value);
+            return;
+        }
+
+        char buffer[detail::max_integer_chars];
+        append(buffer, static_cast<std::size_t>(detail::to_chars_unchecked(buffer, value) - buffer));
+    }
+
+    void write(bool value) = delete;
+
+    void write(double value, chars_format fmt = chars_format::general)
+    {
+        const std::size_t size = detail::max_shortest_chars_for(fmt);
+        char* const first = reserve(size);
+        if (first != nullptr)
+        {
+            pos_ = detail::to_chars_unchecked(first, value, fmt);
+            return;
+        }
+
+        char buffer[detail::max_shortest_fixed_chars];
+        append(buffer, static_cast<std::size_t>(detail::to_chars_unchecked(buffer, value, fmt) - buffer));
+    }
+
+    // A negative precision is taken as 6, as with to_chars
+    void write(double value, chars_format fmt, int precision)
+    {
+        if (precision < 0)
+        {
+            precision = 6;
+        }
+
+        const std::size_t size = detail::max_precision_chars_for(fmt, precision);
+        char* const first = reserve(size);
+        if (first != nullptr)
+        {
+            pos_ = detail::to_chars_unchecked(first, value, fmt, precision);
+            return;
+        }
+
+        std::string buffer(size, '\0');
+        append(&buffer[0], static_cast<std::size_t>(detail::to_chars_unchecked(&buffer[0], value, fmt, precision) - &buffer[0]));
+    }
+
+    // float has no unchecked writer, and goes through to_chars with the room that double needs
+    void write(float value, chars_format fmt = chars_format::general)
+    {
+        const std::size_t size = detail::max_shortest_chars_for(fmt);
+        char* const first = reserve(size);
+        if (first != nullptr)
+        {
+            pos_ = to_chars(first, first + size, value, fmt).ptr;
+            return;
+        }
+
+        char buffer[detail::max_shortest_fixed_chars];
+        append(buffer, static_cast<std::size_t>(to_chars(buffer, buffer + sizeof(buffer), value, fmt).ptr - buffer));
+    }
+
+    void write(float value, chars_format fmt, int precision)
+    {
+        if (precision < 0)
+        {
+            precision = 6;
+        }
+
+        const std::size_t size = detail::max_precision_chars_for(fmt, precision);
+        char* const first = reserve(size);
+        if (first != nullptr)
+        {
+            pos_ = to_chars(first, first + size, value, fmt, precision).ptr;
+            return;
+        }
+
+        std::string buffer(size, '\0');
+        append(&buffer[0], static_cast<std::size_t>(to_chars(&buffer[0], &buffer[0] + size, value, fmt, precision).ptr - &buffer[0]));
+    }
+
+    // The characters in between the numbers
+    void put(char c)
+    {
+        if (pos_ == last_)
+        {
+            flush();
+            if (pos_ == last_)
+            {
+                flush_(context_, &c, 1);
+                return;
+            }
+        }
+
+        *pos_++ = c;
+    }
+
+    void append(const char* data, std::size_t size)
+    {
+        if (static_cast<std::size_t>(last_ - pos_) < size)
+        {
+            flush();
+            if (static_cast<std::size_t>(last_ - pos_) < size)
+            {
+                flush_(context_, data, size);
+                return;
+            }
+        }
+
+        std::memcpy(pos_, data, size);
+        pos_ += size;
+    }
+
+    // Hands the characters written so far to the callback
+    void flush()
+    {
+        if (pos_ != first_)
+        {
+            flush_(context_, first_, static_cast<std::size_t>(pos_ - first_));
+            pos_ = first_;
+        }
+    }
+
+    // Number of characters written since the last flush
+    std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(pos_ - first_);
+    }
+
+private:
+    // The position to write size characters at, flushing first when needed, or nullptr when the buffer is too small
+    char* reserve(std::size_t size)
+    {
+        if (BOOST_UNLIKELY(static_cast<std::size_t>(last_ - pos_) < size))
+        {
+            flush();
+            if (static_cast<std::size_t>(last_ - pos_) < size)
+            {
+                return nullptr;
+            }
+        }
+
+        return pos_;
+    }
+
+    std::unique_ptr<char[]> owned_;
+    char* first_;
+    char* pos_;
+    char* last_;
+    flush_function flush_;
+    void* context_;
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_NUMBER_WRITER_HPP_INCLUDED
@@ -0,0 +1,144 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP_INCLUDED
+#define BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP_INCLUDED
+
+#include <boost/charconv/number_reader.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/parallel_for_each_index.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// The input is cut into chunks of at least this many characters
+constexpr std::size_t parallel_min_chunk_size = 256 * 1024;
+
+struct parallel_chunk
+{
+    const char* first;
+    const char* last;
+    std::size_t count;
+    from_chars_result result;
+};
+
+// Chunk boundaries are just past a delimiter, so that no value is split between two chunks
+inline std::vector<parallel_chunk> split_into_chunks(const char* first, const char* last, char delimiter, unsigned threads)
+{
+    const auto size = static_cast<std::size_t>(last - first);
+    const std::size_t chunk_size = (std::max)(parallel_min_chunk_size, size / (threads * parallel_chunks_per_thread) + 1);
+
+    std::vector<parallel_chunk> chunks;
+    const char* p = first;
+    while (p != last)
+    {
+        const char* end = last;
+        if (static_cast<std::size_t>(last - p) > chunk_size)
+        {
+            const void* next_delimiter = std::memchr(p + chunk_size, delimiter, static_cast<std::size_t>(last - p) - chunk_size);
+            end = next_delimiter != nullptr ? static_cast<const char*>(next_delimiter) + 1 : last;
+        }
+
+        chunks.push_back(parallel_chunk {p, end, 0, from_chars_result {end, std::errc()}});
+        p = end;
+    }
+
+    return chunks;
+}
+
+} // namespace detail
+
+// Parses the values of [first, last), which are separated by delimiter and white space, into out in order, with
+// threads threads (std::thread::hardware_concurrency() for 0). Values are read as number_reader reads them.
+// On success ptr is last, and otherwise ptr and ec are those of the first value that could not be read, and out
+// holds the values before it.
+template <typename T, typename std::enable_if<detail::is_integer_value<T>::value || std::is_same<T, float>::value || std::is_same<T, double>::value, bool>::type = true>
+from_chars_result parallel_from_chars(const char* first, const char* last, std::vector<T>& out, char delimiter = '\n', unsigned threads = 0)
+{
+    threads = detail::parallel_thread_count(threads);
+
+    auto chunks = detail::split_into_chunks(first, last, delimiter, threads);
+    const char delimiters[] = {delimiter, '\0'};
+
+    // Each value is one run of characters between separators, so skipping them counts the values of a chunk without
+    // parsing them. The values then go straight to their place in out.
+    detail::parallel_for_each_index(chunks.size(), threads, [&](std::size_t i) {
+        // Everything up to last can be read past the end of the chunk
+        number_reader reader(chunks[i].first, chunks[i].last, static_cast<std::size_t>(last - chunks[i].last));
+        reader.set_delimiters(delimiters);
+        std::size_t count = 0;
+        while (reader.skip())
+        {
+            ++count;
+        }
+
+        chunks[i].count = count;
+    });
+
+    std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        offsets[i + 1] = offsets[i] + chunks[i].count;
+    }
+
+    out.resize(offsets.back());
+
+    // Chunks after one with an error are not parsed
+    std::atomic<std::size_t> first_error {chunks.size()};
+    T* const values = out.data();
+
+    detail::parallel_for_each_index(chunks.size(), threads, [&](std::size_t i) {
+        if (i > first_error.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto& chunk = chunks[i];
+        number_reader reader(chunk.first, chunk.last, static_cast<std::size_t>(last - chunk.last));
+        reader.set_delimiters(delimiters);
+
+        std::size_t count = 0;
+        T value {};
+        while (reader.read(value))
+        {
+            BOOST_CHARCONV_ASSERT(count < chunk.count);
+            values[offsets[i] + count++] = value;
+        }
+
+        if (reader.error() != std::errc())
+        {
+            chunk.count = count;
+            chunk.result = {reader.position(), reader.error()};
+
+            std::size_t expected = first_error.load(std::memory_order_relaxed);
+            while (i < expected && !first_error.compare_exchange_weak(expected, i, std::memory_order_relaxed))
+            {
+            }
+        }
+    });
+
+    const std::size_t error_chunk = first_error.load();
+    if (error_chunk == chunks.size())
+    {
+        return {last, std::errc()};
+    }
+
+    out.resize(offsets[error_chunk] + chunks[error_chunk].count);
+    return chunks[error_chunk].result;
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_FROM_CHARS_HPP_INCLUDED
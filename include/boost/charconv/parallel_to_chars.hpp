@@ -0,0 +1,238 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP_INCLUDED
+#define BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP_INCLUDED
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/parallel_for_each_index.hpp>
+#include <boost/charconv/detail/apply_sign.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <system_error>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// The values are cut into chunks of at least this many
+constexpr std::size_t parallel_min_chunk_values = 16 * 1024;
+
+// Number of characters that to_chars(first, last, values[i]) writes for all of the values, without separators.
+// Runs dragonbox for the digits, but does not print them.
+BOOST_CHARCONV_DECL std::size_t shortest_chars_length(const double* values, std::size_t n) noexcept;
+
+template <typename Integer>
+std::size_t shortest_chars_length(const Integer* values, std::size_t n) noexcept
+{
+    using Unsigned_Integer = make_unsigned_t<Integer>;
+
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const Integer value = values[i];
+        Unsigned_Integer unsigned_value = static_cast<Unsigned_Integer>(value);
+
+        BOOST_IF_CONSTEXPR (is_signed<Integer>::value)
+        {
+            if (value < 0)
+            {
+                ++length;
+                unsigned_value = apply_sign(value);
+            }
+        }
+
+        BOOST_IF_CONSTEXPR (sizeof(Unsigned_Integer) <= sizeof(std::uint32_t))
+        {
+            length += static_cast<std::size_t>(num_digits(static_cast<std::uint32_t>(unsigned_value)));
+        }
+        else BOOST_IF_CONSTEXPR (sizeof(Unsigned_Integer) <= sizeof(std::uint64_t))
+        {
+            length += static_cast<std::size_t>(num_digits(static_cast<std::uint64_t>(unsigned_value)));
+        }
+        else
+        {
+            // The 128-bit num_digits has no digits for zero
+            length += unsigned_value == 0 ? 1 : static_cast<std::size_t>(num_digits(unsigned_value));
+        }
+    }
+
+    return length;
+}
+
+// Writes nothing outside [first, last), and succeeds when the output is exactly as long as [first, last). to_chars_n
+// needs room for the longest output of a value where it writes one, and leaves scratch digits there, so the values
+// in the last 32 characters are written to a buffer and copied over the scratch.
+inline to_chars_result to_chars_each(char* first, char* last, const double* values, std::size_t n, char separator) noexcept
+{
+    constexpr std::size_t tail_room = 32;
+
+    std::size_t tail = n;
+    std::size_t tail_length = 0;
+    while (tail != 0 && tail_length < tail_room)
+    {
+        --tail;
+        tail_length += shortest_chars_length(values + tail, 1) + 1;
+    }
+
+    // At most tail_room characters and one more value, which leaves room for the scratch of the last one
+    char buffer[128];
+    char* tail_first = buffer;
+    if (tail != 0)
+    {
+        *tail_first++ = separator;
+    }
+
+    const auto tail_result = to_chars_n(tail_first, buffer + sizeof(buffer), values + tail, n - tail, chars_format::general, separator);
+    if (tail_result.ec != std::errc())
+    {
+        return tail_result;
+    }
+
+    const auto head_result = to_chars_n(first, last, values, tail, chars_format::general, separator);
+    const auto tail_size = static_cast<std::size_t>(tail_result.ptr - buffer);
+    if (head_result.ec != std::errc() || tail_size > static_cast<std::size_t>(last - head_result.ptr))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(head_result.ptr, buffer, tail_size);
+    return {head_result.ptr + tail_size, std::errc()};
+}
+
+template <typename Integer>
+to_chars_result to_chars_each(char* first, char* last, const Integer* values, std::size_t n, char separator) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i != 0)
+        {
+            if (first >= last)
+            {
+                return {last, std::errc::value_too_large};
+            }
+            *first++ = separator;
+        }
+
+        const auto r = to_chars(first, last, values[i]);
+        if (r.ec != std::errc())
+        {
+            return r;
+        }
+        first = r.ptr;
+    }
+
+    return {first, std::errc()};
+}
+
+// Where each chunk of values starts in the output: the exact lengths of the chunks are computed in parallel, and
+// their prefix sums are the offsets. offsets.back() is the length of the whole output.
+template <typename T>
+std::vector<std::size_t> parallel_chunk_offsets(const T* values, std::size_t n, std::size_t chunk_size, unsigned threads)
+{
+    const std::size_t chunks = (n + chunk_size - 1) / chunk_size;
+    std::vector<std::size_t> offsets(chunks + 1, 0);
+
+    parallel_for_each_index(chunks, threads, [&](std::size_t i) {
+        const std::size_t begin = i * chunk_size;
+        const std::size_t count = (std::min)(chunk_size, n - begin);
+
+        // Every value but the first one in the output is preceded by a separator
+        offsets[i + 1] = shortest_chars_length(values + begin, count) + count - static_cast<std::size_t>(i == 0);
+    });
+
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    return offsets;
+}
+
+template <typename T>
+void parallel_write_chunks(char* first, const T* values, std::size_t n, char separator, std::size_t chunk_size,
+                           const std::vector<std::size_t>& offsets, unsigned threads)
+{
+    parallel_for_each_index(offsets.size() - 1, threads, [&](std::size_t i) {
+        const std::size_t begin = i * chunk_size;
+        char* chunk_first = first + offsets[i];
+        char* const chunk_last = first + offsets[i + 1];
+
+        if (i != 0)
+        {
+            *chunk_first++ = separator;
+        }
+
+        const auto r = to_chars_each(chunk_first, chunk_last, values + begin, (std::min)(chunk_size, n - begin), separator);
+        BOOST_CHARCONV_ASSERT(r.ec == std::errc() && r.ptr == chunk_last);
+        static_cast<void>(r);
+    });
+}
+
+inline std::size_t parallel_chunk_size(std::size_t n, unsigned threads) noexcept
+{
+    return (std::max)(parallel_min_chunk_values, n / (threads * parallel_chunks_per_thread) + 1);
+}
+
+template <typename T>
+struct is_parallel_to_chars_value
+{
+    static constexpr bool value = std::is_same<T, double>::value || is_integer_value<T>::value;
+};
+
+} // namespace detail
+
+// Writes the shortest representation of values[0], ..., values[n - 1] separated by separator (no trailing separator)
+// to [first, last) with threads threads (std::thread::hardware_concurrency() for 0). The output is byte for byte the
+// same as from to_chars_n, or to_chars for each value: every thread writes its values straight to their place in
+// the output, which is found from the exact length of the output of the values before them.
+template <typename T, typename std::enable_if<detail::is_parallel_to_chars_value<T>::value, bool>::type = true>
+to_chars_result parallel_to_chars(char* first, char* last, const T* values, std::size_t n, char separator = '\n', unsigned threads = 0)
+{
+    threads = detail::parallel_thread_count(threads);
+    const std::size_t chunk_size = detail::parallel_chunk_size(n, threads);
+
+    // A single writer needs no offsets, and the length of the output costs about half as much as writing it
+    if (threads == 1 || n <= chunk_size)
+    {
+        return detail::to_chars_each(first, last, values, n, separator);
+    }
+
+    const auto offsets = detail::parallel_chunk_offsets(values, n, chunk_size, threads);
+
+    if (offsets.back() > static_cast<std::size_t>(last - first))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    detail::parallel_write_chunks(first, values, n, separator, chunk_size, offsets, threads);
+    return {first + offsets.back(), std::errc()};
+}
+
+// As above, into a string of the exact length of the output
+template <typename T, typename std::enable_if<detail::is_parallel_to_chars_value<T>::value, bool>::type = true>
+std::string parallel_to_chars(const T* values, std::size_t n, char separator = '\n', unsigned threads = 0)
+{
+    threads = detail::parallel_thread_count(threads);
+    const std::size_t chunk_size = detail::parallel_chunk_size(n, threads);
+    const auto offsets = detail::parallel_chunk_offsets(values, n, chunk_size, threads);
+
+    std::string text(offsets.back(), '\0');
+    detail::parallel_write_chunks(&text[0], values, n, separator, chunk_size, offsets, threads);
+    return text;
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_TO_CHARS_HPP_INCLUDED
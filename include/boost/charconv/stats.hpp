@@ -0,0 +1,39 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_STATS_HPP_INCLUDED
+#define BOOST_CHARCONV_STATS_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// How many conversions took each of the paths of the library since the start of the program, summed over all threads.
+// The counters are only kept when the library is built with BOOST_CHARCONV_ENABLE_STATS, and are all zero otherwise.
+struct stats_snapshot
+{
+    bool enabled;
+
+    // from_chars for float and double in decimal: Clinger's fast path, Eisel-Lemire, and the comparison with all of
+    // the digits in a big integer for the values that Eisel-Lemire can not decide
+    std::uint64_t from_chars_clinger;
+    std::uint64_t from_chars_eisel_lemire;
+    std::uint64_t from_chars_digit_comparison;
+
+    // from_chars for the values that the library can not compute itself (hex floats and some long doubles), which
+    // are given to strtod, and for how many of them the text did not fit the buffer on the stack
+    std::uint64_t from_chars_strtod;
+    std::uint64_t from_chars_strtod_malloc;
+
+    // to_chars for the values that are formatted with snprintf
+    std::uint64_t to_chars_printf;
+};
+
+BOOST_CHARCONV_DECL stats_snapshot stats() noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_STATS_HPP_INCLUDED
@@ -9,8 +9,13 @@
 
 #include <boost/charconv/detail/to_chars_integer_impl.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstddef>
+#include <cstdlib>
 
 namespace boost {
 namespace charconv {
@@ -97,6 +102,11 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, long doubl
                                              chars_format fmt, int precision) noexcept;
 #endif
 
+// Shortest representation of values[0], ..., values[n - 1] separated by separator (no trailing separator),
+// byte for byte the same as calling to_chars on each value
+BOOST_CHARCONV_DECL to_chars_result to_chars_n(char* first, char* last, const double* values, std::size_t n,
+                                               chars_format fmt = chars_format::general, char separator = ',') noexcept;
+
 #ifdef BOOST_CHARCONV_HAS_QUADMATH
 BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, __float128 value,
                                              chars_format fmt = chars_format::general) noexcept;
@@ -141,6 +151,128 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloa
                                              chars_format fmt, int precision) noexcept;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// wchar_t, char8_t, char16_t and char32_t
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+// Copies the ASCII characters [first, last) to out
+BOOST_CHARCONV_DECL void widen_chars(const char* first, const char* last, wchar_t* out) noexcept;
+BOOST_CHARCONV_DECL void widen_chars(const char* first, const char* last, char16_t* out) noexcept;
+BOOST_CHARCONV_DECL void widen_chars(const char* first, const char* last, char32_t* out) noexcept;
+
+// An upper bound of the length of the output of to_chars for Real. Fixed output without a precision can have all
+// the digits of the largest value or the leading zeros of the smallest one, and the other formats are a sign,
+// the digits, the point and an exponent.
+template <typename Real>
+std::ptrdiff_t max_output_length(chars_format fmt, int precision) noexcept
+{
+    // -log10 of the smallest subnormal value, and max_digits10
+    constexpr std::ptrdiff_t max_exponent10 = sizeof(Real) <= 4 ? 45 : sizeof(Real) <= 8 ? 324 : 4966;
+    constexpr std::ptrdiff_t max_digits10 = sizeof(Real) <= 4 ? 9 : sizeof(Real) <= 8 ? 17 : 36;
+
+    constexpr std::ptrdiff_t ptrdiff_max = (std::numeric_limits<std::ptrdiff_t>::max)();
+
+    const std::ptrdiff_t digits = precision < 0 ? max_digits10 : precision;
+    const std::ptrdiff_t other_chars = fmt == chars_format::fixed ? 16 + 2 * max_exponent10 : 16;
+    return digits > ptrdiff_max - other_chars ? ptrdiff_max : digits + other_chars;
+}
+
+// The floating point formatters only write char, so the output goes to a buffer on the stack first.
+// Only large precisions need more than that buffer holds, and then no more than max_length is allocated.
+template <typename UC, typename Convert>
+to_chars_result_t<UC> to_chars_widened(UC* first, UC* last, std::ptrdiff_t max_length, Convert convert) noexcept
+{
+    constexpr std::ptrdiff_t stack_buffer_size = 1024;
+    char stack_buffer[stack_buffer_size];
+
+    const std::ptrdiff_t size = first < last ? last - first : 0;
+    char* buffer = stack_buffer;
+    auto r = convert(buffer, buffer + (size < stack_buffer_size ? size : stack_buffer_size));
+
+    const std::ptrdiff_t heap_buffer_size = size < max_length ? size : max_length;
+    if (r.ec == std::errc::value_too_large && heap_buffer_size > stack_buffer_size)
+    {
+        buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(heap_buffer_size)));
+        if (buffer == nullptr)
+        {
+            return {last, std::errc::not_enough_memory};
+        }
+        r = convert(buffer, buffer + heap_buffer_size);
+    }
+
+    to_chars_result_t<UC> result {last, r.ec};
+    if (r)
+    {
+        widen_chars(buffer, r.ptr, first);
+        result.ptr = first + (r.ptr - buffer);
+    }
+
+    if (buffer != stack_buffer)
+    {
+        std::free(buffer);
+    }
+
+    return result;
+}
+
+#ifdef BOOST_CHARCONV_HAS_CHAR8_T
+// char8_t has the same representation as char, so the output goes straight to the destination
+template <typename Convert>
+to_chars_result_t<char8_t> to_chars_widened(char8_t* first, char8_t* last, std::ptrdiff_t, Convert convert) noexcept
+{
+    const auto narrow_first = reinterpret_cast<char*>(first);
+    const auto r = convert(narrow_first, reinterpret_cast<char*>(last));
+    return {first + (r.ptr - narrow_first), r.ec};
+}
+#endif
+
+} // namespace detail
+
+template <typename UC, typename Integer, typename std::enable_if<detail::is_extended_char<UC>::value && detail::is_integer_value<Integer>::value, bool>::type = true>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars(UC* first, UC* last, Integer value, int base = 10) noexcept
+{
+    // Large enough for a 128-bit value in base 2 and its sign
+    char buffer[130] {};
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+    if (!r)
+    {
+        return {last, r.ec};
+    }
+
+    const auto length = r.ptr - buffer;
+    if (first > last || length > last - first)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    for (std::ptrdiff_t i = 0; i < length; ++i)
+    {
+        first[i] = static_cast<UC>(buffer[i]);
+    }
+
+    return {first + length, std::errc()};
+}
+
+template <typename UC, typename Real, typename std::enable_if<detail::is_extended_char<UC>::value && std::is_floating_point<Real>::value, bool>::type = true>
+to_chars_result_t<UC> to_chars(UC* first, UC* last, Real value, chars_format fmt = chars_format::general) noexcept
+{
+    return detail::to_chars_widened(first, last, detail::max_output_length<Real>(fmt, -1),
+                                    [value, fmt](char* f, char* l) noexcept {
+        return boost::charconv::to_chars(f, l, value, fmt);
+    });
+}
+
+template <typename UC, typename Real, typename std::enable_if<detail::is_extended_char<UC>::value && std::is_floating_point<Real>::value, bool>::type = true>
+to_chars_result_t<UC> to_chars(UC* first, UC* last, Real value, chars_format fmt, int precision) noexcept
+{
+    return detail::to_chars_widened(first, last, detail::max_output_length<Real>(fmt, precision),
+                                    [value, fmt, precision](char* f, char* l) noexcept {
+        return boost::charconv::to_chars(f, l, value, fmt, precision);
+    });
+}
+
 } // namespace charconv
 } // namespace boost
 
@@ -0,0 +1,408 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/c_api.h>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/bit.hpp>
+#include <system_error>
+#include <climits>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cfloat>
+
+namespace {
+
+// isspace in the "C" locale
+inline bool is_c_space(char c) noexcept
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+inline bool is_hex_digit(char c) noexcept
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+inline int hex_digit_value(char c) noexcept
+{
+    return c >= '0' && c <= '9' ? c - '0' :
+           c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+           c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+}
+
+inline bool is_hex_prefix(const char* p) noexcept
+{
+    return p[0] == '0' && (p[1] == 'x' || p[1] == 'X');
+}
+
+inline void set_endptr(char** endptr, const char* p) noexcept
+{
+    if (endptr != nullptr)
+    {
+        *endptr = const_cast<char*>(p);
+    }
+}
+
+// C hexadecimal floats have a binary exponent, where chars_format::hex takes a power of 10, so they are read here.
+// The first 16 significant digits are kept, and the digits after them only decide whether the sticky last bit is set.
+double parse_hex_float(const char* p, const char*& end, bool& out_of_range) noexcept
+{
+    std::uint64_t significand = 0;
+    std::int64_t exponent = 0;
+    int digits = 0;
+    bool dropped_nonzero = false;
+    bool seen_point = false;
+
+    for (;; ++p)
+    {
+        if (*p == '.' && !seen_point)
+        {
+            seen_point = true;
+            continue;
+        }
+
+        const int digit = hex_digit_value(*p);
+        if (digit < 0)
+        {
+            break;
+        }
+
+        if (digits < 16)
+        {
+            significand = (significand << 4) | static_cast<std::uint64_t>(digit);
+            digits += significand != 0 ? 1 : 0;
+            exponent -= seen_point ? 4 : 0;
+        }
+        else
+        {
+            dropped_nonzero |= digit != 0;
+            exponent += seen_point ? 0 : 4;
+        }
+    }
+
+    if (*p == 'p' || *p == 'P')
+    {
+        const char* q = p + 1;
+        const bool is_negative_exponent = *q == '-';
+        if (*q == '-' || *q == '+')
+        {
+            ++q;
+        }
+
+        if (*q >= '0' && *q <= '9')
+        {
+            // Anything past the clamp is out of range either way
+            std::int64_t binary_exponent = 0;
+            for (; *q >= '0' && *q <= '9'; ++q)
+            {
+                binary_exponent = binary_exponent < 100000 ? binary_exponent * 10 + (*q - '0') : binary_exponent;
+            }
+
+            exponent += is_negative_exponent ? -binary_exponent : binary_exponent;
+            p = q;
+        }
+    }
+
+    end = p;
+    if (significand == 0)
+    {
+        return 0;
+    }
+
+    // At least 61 significant bits remain, so the sticky bit is always below the rounding bit
+    significand |= dropped_nonzero ? 1U : 0U;
+
+    const int leading_zeros = boost::core::countl_zero(significand);
+    significand <<= leading_zeros;
+    exponent -= leading_zeros;
+
+    // The value is now significand * 2^exponent with the top bit of significand set
+    if (exponent + 63 >= -1022)
+    {
+        if (exponent > 1024)
+        {
+            out_of_range = true;
+            return HUGE_VAL;
+        }
+
+        // The conversion rounds to 53 bits, and the scaling is exact unless it overflows
+        const double value = std::ldexp(static_cast<double>(significand), static_cast<int>(exponent));
+        out_of_range = std::isinf(value);
+        return value;
+    }
+
+    // Subnormal values are rounded once, to the bits down to 2^-1074
+    const std::int64_t shift = -1074 - exponent;
+    if (shift > 64)
+    {
+        out_of_range = true;
+        return 0;
+    }
+
+    std::uint64_t rounded = shift == 64 ? 0 : significand >> shift;
+    const std::uint64_t remainder = shift == 64 ? significand : significand & ((UINT64_C(1) << shift) - 1U);
+    const std::uint64_t half = UINT64_C(1) << (shift - 1);
+    if (remainder > half || (remainder == half && (rounded & 1U) != 0))
+    {
+        ++rounded;
+    }
+
+    // Inexact subnormal values count as underflow, as with glibc
+    out_of_range = remainder != 0;
+    return std::ldexp(static_cast<double>(rounded), -1074);
+}
+
+// As with glibc, reading a subnormal value counts as underflow unless the decimal input is the exact value. Subnormal
+// values have at least 715 significant digits, so this compares the digits of the input with those of the value.
+bool is_inexact_subnormal(const char* first, const char* last, double value) noexcept
+{
+    char digits[800];
+    const auto r = boost::charconv::to_chars(digits, digits + sizeof(digits), value, boost::charconv::chars_format::scientific, 766);
+
+    std::size_t length = 0;
+    for (const char* q = digits; q != r.ptr && *q != 'e'; ++q)
+    {
+        if (*q != '.')
+        {
+            digits[length++] = *q;
+        }
+    }
+
+    while (length > 0 && digits[length - 1] == '0')
+    {
+        --length;
+    }
+
+    std::size_t i = 0;
+    for (; first != last && *first != 'e' && *first != 'E'; ++first)
+    {
+        if (*first == '.' || (i == 0 && *first == '0'))
+        {
+            continue;
+        }
+
+        // Zeros past the end of the value are still exact
+        if (i == length ? *first != '0' : *first != digits[i++])
+        {
+            return true;
+        }
+    }
+
+    return i != length;
+}
+
+// Writes at most size - 1 characters and a terminating '\0' as snprintf does, and returns the full length
+inline int copy_out(char* buffer, std::size_t size, const char* first, const char* last) noexcept
+{
+    const auto length = static_cast<std::size_t>(last - first);
+    if (size != 0)
+    {
+        const std::size_t n = length < size ? length : size - 1;
+        std::memcpy(buffer, first, n);
+        buffer[n] = '\0';
+    }
+
+    return static_cast<int>(length);
+}
+
+// write(first, last) formats into [first, last), which holds at least max_length characters, and returns the end.
+// When the buffer of the caller is large enough the output goes there directly, and through a copy otherwise.
+template <typename Writer>
+int write_c_string(char* buffer, std::size_t size, std::size_t max_length, Writer write) noexcept
+{
+    if (size > max_length)
+    {
+        char* const end = write(buffer, buffer + max_length);
+        *end = '\0';
+        return static_cast<int>(end - buffer);
+    }
+
+    char local_buffer[1024];
+    if (max_length <= sizeof(local_buffer))
+    {
+        return copy_out(buffer, size, local_buffer, write(local_buffer, local_buffer + max_length));
+    }
+
+    char* const heap_buffer = static_cast<char*>(std::malloc(max_length));
+    if (heap_buffer == nullptr)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    const int length = copy_out(buffer, size, heap_buffer, write(heap_buffer, heap_buffer + max_length));
+    std::free(heap_buffer);
+    return length;
+}
+
+// to_chars writes nan(ind) and nan(snan), where printf writes nan
+inline int write_nan(char* buffer, std::size_t size, double value) noexcept
+{
+    const char* const str = std::signbit(value) ? "-nan" : "nan";
+    return copy_out(buffer, size, str, str + std::strlen(str));
+}
+
+} // Namespace
+
+double bc_strtod(const char* str, char** endptr)
+{
+    const char* p = str;
+    while (is_c_space(*p))
+    {
+        ++p;
+    }
+
+    const bool is_negative = *p == '-';
+    if (*p == '-' || *p == '+')
+    {
+        ++p;
+    }
+
+    double value = 0;
+
+    // The prefix only counts when a digit follows, so that "0x" alone reads as 0
+    if (is_hex_prefix(p) && (is_hex_digit(p[2]) || (p[2] == '.' && is_hex_digit(p[3]))))
+    {
+        const char* end;
+        bool out_of_range = false;
+        value = parse_hex_float(p + 2, end, out_of_range);
+        if (out_of_range)
+        {
+            errno = ERANGE;
+        }
+
+        set_endptr(endptr, end);
+        return is_negative ? -value : value;
+    }
+
+    // from_chars would take a second sign
+    if (*p == '-' || *p == '+')
+    {
+        set_endptr(endptr, str);
+        return 0;
+    }
+
+    const auto r = boost::charconv::from_chars(p, value);
+    if (r.ec == std::errc::invalid_argument)
+    {
+        set_endptr(endptr, str);
+        return 0;
+    }
+
+    if (r.ec == std::errc::result_out_of_range)
+    {
+        // Only from_chars_erange tells overflow from underflow, and gives HUGE_VAL or 0 as strtod does
+        boost::charconv::from_chars_erange(p, r.ptr, value);
+        errno = ERANGE;
+    }
+    else if (value != 0 && std::fabs(value) < DBL_MIN && is_inexact_subnormal(p, r.ptr, value))
+    {
+        errno = ERANGE;
+    }
+
+    set_endptr(endptr, r.ptr);
+    return is_negative ? -value : value;
+}
+
+long long bc_strtoll(const char* str, char** endptr, int base)
+{
+    if (base < 0 || base == 1 || base > 36)
+    {
+        set_endptr(endptr, str);
+        errno = EINVAL;
+        return 0;
+    }
+
+    const char* p = str;
+    while (is_c_space(*p))
+    {
+        ++p;
+    }
+
+    const bool is_negative = *p == '-';
+    if (*p == '-' || *p == '+')
+    {
+        ++p;
+    }
+
+    if ((base == 0 || base == 16) && is_hex_prefix(p) && is_hex_digit(p[2]))
+    {
+        base = 16;
+        p += 2;
+    }
+    else if (base == 0)
+    {
+        base = *p == '0' ? 8 : 10;
+    }
+
+    // An unsigned magnitude, since LLONG_MIN has no positive counterpart
+    unsigned long long magnitude = 0;
+    const auto r = *p == '-' || *p == '+' ? boost::charconv::from_chars_result {p, std::errc::invalid_argument} :
+                                            boost::charconv::from_chars(p, magnitude, base);
+    if (r.ec == std::errc::invalid_argument)
+    {
+        set_endptr(endptr, str);
+        return 0;
+    }
+
+    set_endptr(endptr, r.ptr);
+
+    constexpr auto max_magnitude = static_cast<unsigned long long>(LLONG_MAX);
+    if (r.ec == std::errc::result_out_of_range || magnitude > max_magnitude + (is_negative ? 1U : 0U))
+    {
+        errno = ERANGE;
+        return is_negative ? LLONG_MIN : LLONG_MAX;
+    }
+
+    if (is_negative)
+    {
+        return magnitude > max_magnitude ? LLONG_MIN : -static_cast<long long>(magnitude);
+    }
+
+    return static_cast<long long>(magnitude);
+}
+
+int bc_dtoa_shortest(char* buffer, std::size_t size, double value)
+{
+    if (std::isnan(value))
+    {
+        return write_nan(buffer, size, value);
+    }
+
+    // -2.2250738585072014e-308 is the longest output
+    return write_c_string(buffer, size, 32, [value](char* first, char* last) noexcept {
+        return boost::charconv::to_chars(first, last, value).ptr;
+    });
+}
+
+int bc_dtoa_precision(char* buffer, std::size_t size, double value, int precision)
+{
+    if (std::isnan(value))
+    {
+        return write_nan(buffer, size, value);
+    }
+
+    // As in printf a negative precision is taken as if it was omitted
+    if (precision < 0)
+    {
+        precision = 6;
+    }
+    else if (precision > INT_MAX - 16)
+    {
+        errno = EOVERFLOW;
+        return -1;
+    }
+
+    // The sign, precision digits, the decimal point, and the longer of an exponent and the zeros of 0.0001
+    const auto max_length = static_cast<std::size_t>(precision) + 16U;
+    return write_c_string(buffer, size, max_length, [value, precision](char* first, char* last) noexcept {
+        return boost::charconv::to_chars(first, last, value, boost::charconv::chars_format::general, precision).ptr;
+    });
+}
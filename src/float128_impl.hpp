@@ -155,82 +155,6 @@ inline __float128 compute_float128(std::int64_t q, Unsigned_Integer w, bool nega
     return 0;
 }
 
-// --------------------------------------------------------------------------------------------------------------------
-// fallback printf
-// --------------------------------------------------------------------------------------------------------------------
-
-template <>
-inline to_chars_result to_chars_printf_impl<__float128>(char* first, char* last, __float128 value, chars_format fmt, int precision)
-{
-    // v % + . + num_digits(INT_MAX) + specifier + null terminator
-    // 1 + 1 + 10 + 1 + 1
-    char format[14] {};
-    std::memcpy(format, "%", 1); // NOLINT : No null terminator is purposeful
-    std::size_t pos = 1;
-
-    // precision of -1 is unspecified
-    if (precision != -1 && fmt != chars_format::fixed)
-    {
-        format[pos] = '.';
-        ++pos;
-        const auto unsigned_precision = static_cast<std::uint32_t>(precision);
-        if (unsigned_precision < 10)
-        {
-            boost::charconv::detail::print_1_digit(unsigned_precision, format + pos);
-            ++pos;
-        }
-        else if (unsigned_precision < 100)
-        {
-            boost::charconv::detail::print_2_digits(unsigned_precision, format + pos);
-            pos += 2;
-        }
-        else
-        {
-            boost::charconv::detail::to_chars_int(format + pos, format + sizeof(format), precision);
-            pos = std::strlen(format);
-        }
-    }
-    else if (fmt == chars_format::fixed)
-    {
-        // Force 0 decimal places
-        std::memcpy(format + pos, ".0", 2); // NOLINT : No null terminator is purposeful
-        pos += 2;
-    }
-
-    // Add the type identifier
-    format[pos] = 'Q';
-    ++pos;
-
-    // Add the format character
-    switch (fmt)
-    {
-        case boost::charconv::chars_format::general:
-            format[pos] = 'g';
-            break;
-
-        case boost::charconv::chars_format::scientific:
-            format[pos] = 'e';
-            break;
-
-        case boost::charconv::chars_format::fixed:
-            format[pos] = 'f';
-            break;
-
-        case boost::charconv::chars_format::hex:
-            format[pos] = 'a';
-            break;
-    }
-
-    const auto rv = quadmath_snprintf(first, static_cast<std::size_t>(last - first), format, value);
-
-    if (rv <= 0)
-    {
-        return {last, static_cast<std::errc>(errno)};
-    }
-
-    return {first + rv, std::errc()};
-}
-
 // --------------------------------------------------------------------------------------------------------------------
 // fallback strtod
 // --------------------------------------------------------------------------------------------------------------------
@@ -276,6 +200,8 @@ inline from_chars_result from_chars_strtod_impl<__float128>(const char* first, c
 template <>
 inline from_chars_result from_chars_strtod<__float128>(const char* first, const char* last, __float128& value) noexcept
 {
+    BOOST_CHARCONV_STATS_COUNT(from_chars_strtod);
+
     if (last - first < 1024)
     {
         char buffer[1024];
@@ -284,6 +210,7 @@ inline from_chars_result from_chars_strtod<__float128>(const char* first, const
 
     // If the string to be parsed does not fit into the 1024 byte static buffer than we have to allocate a buffer.
     // malloc is used here because it does not throw on allocation failure.
+    BOOST_CHARCONV_STATS_COUNT(from_chars_strtod_malloc);
 
     char* buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(last - first + 1)));
     if (buffer == nullptr)
@@ -15,13 +15,21 @@
 #include "from_chars_float_impl.hpp"
 #include <boost/charconv/detail/fast_float/fast_float.hpp>
 #include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/decimal_parts.hpp>
+#include <boost/charconv/number.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <string>
 #include <cstdlib>
 #include <cerrno>
 #include <cstring>
 #include <limits>
+#include <algorithm>
+
+#ifdef BOOST_CHARCONV_HAS_SSE2
+#  include <emmintrin.h>
+#endif
 
 #if BOOST_CHARCONV_LDBL_BITS > 64
 #  include <boost/charconv/detail/compute_float80.hpp>
@@ -505,3 +513,973 @@ boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::stri
     return from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
 }
 #endif
+
+namespace {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_zstr_impl(const char* zstr, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    namespace ff = boost::charconv::detail::fast_float;
+
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        auto pns = ff::parse_number_string<char, true>(zstr, nullptr, ff::parse_options {fmt});
+        if (pns.valid)
+        {
+            T temp_value {};
+            const auto r = ff::from_parsed_number_string(pns, temp_value);
+            if (r)
+            {
+                value = temp_value;
+            }
+
+            return r;
+        }
+    }
+
+    // inf, nan, hex and errors are rare enough to measure the string for
+    return boost::charconv::from_chars(zstr, zstr + std::strlen(zstr), value, fmt);
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* zstr, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_zstr_impl(zstr, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* zstr, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_zstr_impl(zstr, value, fmt);
+}
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* zstr, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    // The long double parser needs the end of the input
+    return boost::charconv::from_chars(zstr, zstr + std::strlen(zstr), value, fmt);
+}
+#endif
+
+namespace {
+
+// Same grammar as fast_float::parse_number_string, but keeps as many digits as fit into Unsigned_Integer
+// and records whether any non-zero digit had to be dropped
+template <typename Unsigned_Integer, int max_digits>
+boost::charconv::from_chars_result parse_decimal_impl(const char* first, const char* last,
+                                                      boost::charconv::decimal_parts<Unsigned_Integer>& value,
+                                                      boost::charconv::chars_format fmt) noexcept
+{
+    if (first >= last || fmt == boost::charconv::chars_format::hex)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const char* p = first;
+    bool sign = false;
+    if (*p == '-')
+    {
+        sign = true;
+        ++p;
+    }
+
+    const bool json = fmt == boost::charconv::chars_format::json;
+    if (json && (p == last || *p < '0' || *p > '9' || (*p == '0' && p + 1 != last && p[1] >= '0' && p[1] <= '9')))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    Unsigned_Integer significand = 0;
+    std::int64_t exponent = 0;
+    std::int64_t digit_count = 0;
+    int digits = 0;
+    int kept = 0;
+    bool truncated = false;
+
+    const auto add_digit = [&](unsigned digit) noexcept
+    {
+        if (digits == 0 && digit == 0)
+        {
+            return;
+        }
+
+        ++digits;
+        if (kept < max_digits)
+        {
+            significand = static_cast<Unsigned_Integer>(significand * 10U + digit);
+            ++kept;
+        }
+        else
+        {
+            ++exponent;
+            truncated = truncated || digit != 0;
+        }
+    };
+
+    while (p != last && *p >= '0' && *p <= '9')
+    {
+        add_digit(static_cast<unsigned>(*p - '0'));
+        ++digit_count;
+        ++p;
+    }
+
+    if (p != last && *p == '.')
+    {
+        ++p;
+        if (json && (p == last || *p < '0' || *p > '9'))
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        while (p != last && *p >= '0' && *p <= '9')
+        {
+            add_digit(static_cast<unsigned>(*p - '0'));
+            --exponent;
+            ++digit_count;
+            ++p;
+        }
+    }
+
+    if (digit_count == 0)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const bool has_scientific = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::scientific)) != 0;
+    const bool has_fixed = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::fixed)) != 0;
+
+    if (has_scientific && p != last && (*p == 'e' || *p == 'E'))
+    {
+        const char* location_of_e = p;
+        ++p;
+        bool neg_exp = false;
+        if (p != last && *p == '-')
+        {
+            neg_exp = true;
+            ++p;
+        }
+        else if (p != last && *p == '+')
+        {
+            ++p;
+        }
+
+        if (p == last || *p < '0' || *p > '9')
+        {
+            if (!has_fixed || json)
+            {
+                return {first, std::errc::invalid_argument};
+            }
+            p = location_of_e;
+        }
+        else
+        {
+            std::int64_t exp_number = 0;
+            while (p != last && *p >= '0' && *p <= '9')
+            {
+                if (exp_number < 0x10000000)
+                {
+                    exp_number = 10 * exp_number + (*p - '0');
+                }
+                ++p;
+            }
+            exponent += neg_exp ? -exp_number : exp_number;
+        }
+    }
+    else if (has_scientific && !has_fixed)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    value.significand = significand;
+    value.exponent = significand == 0 ? 0 : exponent;
+    value.digits = digits;
+    value.sign = sign;
+    value.truncated = truncated;
+
+    return {p, std::errc()};
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::parse_decimal(const char* first, const char* last, boost::charconv::decimal_parts<std::uint64_t>& value, boost::charconv::chars_format fmt) noexcept
+{
+    return parse_decimal_impl<std::uint64_t, 19>(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::parse_decimal(boost::core::string_view sv, boost::charconv::decimal_parts<std::uint64_t>& value, boost::charconv::chars_format fmt) noexcept
+{
+    return parse_decimal_impl<std::uint64_t, 19>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+boost::charconv::from_chars_result boost::charconv::parse_decimal(const char* first, const char* last, boost::charconv::decimal_parts<boost::uint128_type>& value, boost::charconv::chars_format fmt) noexcept
+{
+    return parse_decimal_impl<boost::uint128_type, 38>(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::parse_decimal(boost::core::string_view sv, boost::charconv::decimal_parts<boost::uint128_type>& value, boost::charconv::chars_format fmt) noexcept
+{
+    return parse_decimal_impl<boost::uint128_type, 38>(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+#endif
+
+// The digits are scanned once by parse_number_string, whose mantissa is exact unless there are more than 19
+// significant digits. Only integers of 20 or more digits, which may still fit into std::uint64_t, are read again.
+boost::charconv::from_chars_result boost::charconv::from_chars_number(const char* first, const char* last, boost::charconv::number& value,
+                                                                     boost::charconv::chars_format fmt) noexcept
+{
+    using namespace boost::charconv::detail::fast_float;
+
+    if (first == last || fmt == boost::charconv::chars_format::hex)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto pns = parse_number_string<char>(first, last, parse_options_t<char>{fmt});
+    if (!pns.valid)
+    {
+        if (fmt == boost::charconv::chars_format::json)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        double result {};
+        const auto r = boost::charconv::detail::fast_float::detail::parse_infnan(first, last, result);
+        if (r)
+        {
+            value.kind = number_kind::double_;
+            value.double_ = result;
+        }
+
+        return r;
+    }
+
+    const char* const integer_end = pns.integer.ptr + pns.integer.len();
+    if (pns.lastmatch == integer_end)
+    {
+        if (!pns.too_many_digits)
+        {
+            constexpr auto max_int64 = static_cast<std::uint64_t>((std::numeric_limits<std::int64_t>::max)());
+
+            if (pns.negative && pns.mantissa <= max_int64 + 1)
+            {
+                value.kind = number_kind::int64;
+                value.int64 = pns.mantissa == 0 ? 0 : -static_cast<std::int64_t>(pns.mantissa - 1) - 1;
+                return {pns.lastmatch, std::errc()};
+            }
+
+            if (!pns.negative)
+            {
+                if (pns.mantissa <= max_int64)
+                {
+                    value.kind = number_kind::int64;
+                    value.int64 = static_cast<std::int64_t>(pns.mantissa);
+                }
+                else
+                {
+                    value.kind = number_kind::uint64;
+                    value.uint64 = pns.mantissa;
+                }
+
+                return {pns.lastmatch, std::errc()};
+            }
+        }
+        else if (!pns.negative)
+        {
+            std::uint64_t result {};
+            if (boost::charconv::from_chars(pns.integer.ptr, integer_end, result))
+            {
+                value.kind = number_kind::uint64;
+                value.uint64 = result;
+                return {pns.lastmatch, std::errc()};
+            }
+        }
+    }
+
+    double result {};
+    const auto r = from_parsed_number_string(pns, result);
+    if (r)
+    {
+        value.kind = number_kind::double_;
+        value.double_ = result;
+    }
+
+    return r;
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_number(boost::core::string_view sv, boost::charconv::number& value,
+                                                                     boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::from_chars_number(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+namespace {
+
+// Only these characters can be part of a number, including nan(n-char-seq) and hex
+template <typename UC>
+inline bool is_number_char(UC c) noexcept
+{
+    return (c >= UC('0') && c <= UC('9')) || (c >= UC('a') && c <= UC('z')) || (c >= UC('A') && c <= UC('Z')) ||
+           c == UC('.') || c == UC('-') || c == UC('+') || c == UC('_') || c == UC('(') || c == UC(')');
+}
+
+template <typename UC, typename T>
+inline boost::charconv::from_chars_result_t<UC> from_chars_narrowed_impl(const UC* first, std::size_t length, T& value,
+                                                                        boost::charconv::chars_format fmt, char* buffer) noexcept
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        buffer[i] = static_cast<char>(first[i]);
+    }
+
+    const auto r = boost::charconv::from_chars(buffer, buffer + length, value, fmt);
+    return {first + (r.ptr - buffer), r.ec};
+}
+
+// For the formats and types that have no parser templated on the character type, the number is copied
+// to char first. The copy stops at the first character that can not be part of a number.
+template <typename UC, typename T>
+inline boost::charconv::from_chars_result_t<UC> from_chars_narrowed(const UC* first, const UC* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    std::size_t length = 0;
+    while (first + length < last && is_number_char(first[length]))
+    {
+        ++length;
+    }
+
+    // The parsers for char may take an empty range for a number, so a text that starts with any other character is
+    // rejected here as the char overloads reject it
+    if (length == 0)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    if (length < 1024)
+    {
+        char buffer[1024];
+        return from_chars_narrowed_impl(first, length, value, fmt, buffer);
+    }
+
+    // Same as from_chars_strtod, malloc is used because it does not throw on allocation failure
+    char* buffer = static_cast<char*>(std::malloc(length));
+    if (buffer == nullptr)
+    {
+        return {first, std::errc::not_enough_memory};
+    }
+
+    const auto r = from_chars_narrowed_impl(first, length, value, fmt, buffer);
+    std::free(buffer);
+
+    return r;
+}
+
+template <typename UC, typename T>
+inline boost::charconv::from_chars_result_t<UC> from_chars_extended_char(const UC* first, const UC* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt == boost::charconv::chars_format::hex)
+    {
+        return from_chars_narrowed(first, last, value, fmt);
+    }
+
+    // fast_float is templated on the character type
+    T temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars(first, last, temp_value, fmt);
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+template <typename UC>
+inline boost::charconv::from_chars_result_t<UC> from_chars_extended_char(const UC* first, const UC* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_narrowed(first, last, value, fmt);
+}
+
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_extended_char(first, last, value, fmt);
+}
+
+namespace {
+
+// Values that are parsed together, so that the processor can overlap the work on neighbouring values
+constexpr std::size_t from_chars_n_block = 16;
+
+enum class field_state : unsigned char
+{
+    clinger,    // exact with one floating point operation
+    lemire,     // needs the Eisel-Lemire algorithm
+    slow,       // needs the full parser
+    done,       // already parsed
+    failed
+};
+
+inline bool is_space(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skip_leading_space(const char* p, const char* last) noexcept
+{
+    while (p != last && (is_space(*p) || *p == '\n'))
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+// Moves past the separator that follows a value, or returns nullptr if the value is followed by something else
+inline const char* skip_separator(const char* p, const char* last, char separator) noexcept
+{
+    const char* const value_end = p;
+    while (p != last && is_space(*p))
+    {
+        ++p;
+    }
+
+    if (p == last)
+    {
+        return p;
+    }
+    if (*p == separator || *p == '\n')
+    {
+        return p + 1;
+    }
+    if ((separator == ' ' || separator == '\t') && p != value_end)
+    {
+        return p;
+    }
+
+    return nullptr;
+}
+
+#ifdef BOOST_CHARCONV_HAS_SSE2
+
+// Bit i is set when p[i] is a decimal digit, for the next 32 characters
+inline std::uint32_t digit_mask(const char* p) noexcept
+{
+    // Moves '0', ..., '9' to the lowest signed bytes
+    const __m128i offset = _mm_set1_epi8(static_cast<char>(0x80 - '0'));
+    const __m128i limit = _mm_set1_epi8(-128 + 10);
+
+    const __m128i low = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), offset);
+    const __m128i high = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), offset);
+
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(low, limit))) |
+           (static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(high, limit))) << 16);
+}
+
+// Parses a number with at most 19 digits that ends within the next 32 characters, which is nearly every number in a data file.
+// The lengths of the integer part and the fraction come from one classification of the characters, instead of a loop
+// over them whose trip count the processor can not predict. Returns false for anything else, which is then left to
+// parse_number_string. p must be before last, and with Padded the characters past last are read and then masked out,
+// instead of requiring 32 characters before last.
+template <bool Padded>
+inline bool parse_number_sse2(const char* p, const char* last, boost::charconv::chars_format fmt, std::uint64_t& mantissa,
+                              std::int64_t& exponent, bool& negative, const char*& end) noexcept
+{
+    namespace ff = boost::charconv::detail::fast_float;
+
+    negative = *p == '-';
+    const char* const digits = negative ? p + 1 : p;
+    const std::ptrdiff_t available = last - digits;
+    if (!Padded && available < 32)
+    {
+        return false;
+    }
+
+    std::uint32_t digits_found = digit_mask(digits);
+    if (Padded && available < 32)
+    {
+        digits_found &= (UINT32_C(1) << available) - 1U;
+    }
+
+    const std::uint64_t non_digits = ~static_cast<std::uint64_t>(digits_found);
+    const int integer_length = boost::core::countr_zero(non_digits);
+    int fraction_length = 0;
+    int length = integer_length;
+    if (integer_length < available && integer_length < 32 && digits[integer_length] == '.')
+    {
+        fraction_length = boost::core::countr_zero(non_digits >> (integer_length + 1));
+        length = integer_length + 1 + fraction_length;
+    }
+
+    const int digit_count = integer_length + fraction_length;
+    if (digit_count == 0 || digit_count > 19 || length >= 32)
+    {
+        return false;
+    }
+
+    // parse_number_string reports what JSON does not allow
+    if (fmt == boost::charconv::chars_format::json &&
+        (integer_length == 0 || (integer_length > 1 && digits[0] == '0') || (length != integer_length && fraction_length == 0)))
+    {
+        return false;
+    }
+
+    // Remove the decimal point
+    const __m128i index = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i after_point = _mm_cmpgt_epi8(index, _mm_set1_epi8(static_cast<char>(integer_length - 1)));
+    const __m128i v = _mm_or_si128(_mm_and_si128(after_point, _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + 1))),
+                                   _mm_andnot_si128(after_point, _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits))));
+
+    char buffer[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), v);
+
+    // The characters after the last digit are shifted out, so that the mantissa stays small enough for Clinger's fast path
+    std::uint64_t value;
+    if (digit_count <= 8)
+    {
+        value = boost::charconv::detail::parse_leading_digits(ff::read_u64(buffer), digit_count);
+    }
+    else
+    {
+        const int low_count = digit_count < 16 ? digit_count - 8 : 8;
+        value = ff::parse_eight_digits_unrolled(ff::read_u64(buffer)) * boost::charconv::detail::padded_powers_of_ten[low_count] +
+                boost::charconv::detail::parse_leading_digits(ff::read_u64(buffer + 8), low_count);
+
+        // Up to three more digits, without a branch since 16 and 17 digits are equally common
+        for (int i = 16; i < 19; ++i)
+        {
+            const auto next = value * 10U + static_cast<std::uint64_t>(digits[i < integer_length ? i : i + 1] - '0');
+            value = i < digit_count ? next : value;
+        }
+    }
+
+    mantissa = value;
+    exponent = -fraction_length;
+    end = digits + length;
+
+    const bool has_scientific = (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::scientific)) != 0;
+    if (has_scientific && end != last && (*end == 'e' || *end == 'E'))
+    {
+        const char* e = end + 1;
+        bool neg_exp = false;
+        if (e != last && (*e == '-' || *e == '+'))
+        {
+            neg_exp = *e == '-';
+            ++e;
+        }
+        if (e == last || *e < '0' || *e > '9')
+        {
+            return false;
+        }
+
+        std::int64_t exp_number = 0;
+        while (e != last && *e >= '0' && *e <= '9')
+        {
+            if (exp_number < 0x10000000)
+            {
+                exp_number = 10 * exp_number + (*e - '0');
+            }
+            ++e;
+        }
+
+        exponent += neg_exp ? -exp_number : exp_number;
+        end = e;
+    }
+    else if (has_scientific && (static_cast<unsigned>(fmt) & static_cast<unsigned>(boost::charconv::chars_format::fixed)) == 0)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+#endif // BOOST_CHARCONV_HAS_SSE2
+
+// Moves past the rest of a malformed field
+inline const char* skip_field(const char* p, const char* last, char separator) noexcept
+{
+    while (p != last && *p != separator && *p != '\n')
+    {
+        ++p;
+    }
+
+    return p == last ? p : p + 1;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_n(const char* first, const char* last, double* values, std::size_t n,
+                                                                 std::uint64_t* failed, boost::charconv::chars_format fmt, char separator) noexcept
+{
+    namespace ff = boost::charconv::detail::fast_float;
+    using format = ff::binary_format<double>;
+
+    from_chars_result result {first, std::errc()};
+
+    if (failed != nullptr)
+    {
+        std::memset(failed, 0, (n + 63) / 64 * sizeof(std::uint64_t));
+    }
+
+    const auto fail = [&](std::size_t i, std::errc ec)
+    {
+        if (failed != nullptr)
+        {
+            failed[i / 64] |= static_cast<std::uint64_t>(1) << (i % 64);
+        }
+        if (result.ec == std::errc())
+        {
+            result.ec = ec;
+        }
+    };
+
+    // Clinger's fast path is only exact when rounding to nearest, otherwise these values take the full parser
+    const bool clinger_allowed = ff::detail::rounds_to_nearest();
+    const ff::parse_options options {fmt};
+
+    std::uint64_t mantissa[from_chars_n_block];
+    std::int64_t exponent[from_chars_n_block];
+    bool negative[from_chars_n_block];
+    const char* field[from_chars_n_block];
+    double parsed[from_chars_n_block];
+    std::errc error[from_chars_n_block];
+    field_state state[from_chars_n_block];
+
+    const char* p = first;
+    std::size_t i = 0;
+
+    while (i < n)
+    {
+        const std::size_t count = (std::min)(from_chars_n_block, n - i);
+
+        // Stage 1: find the digits, the exponent and the end of each value
+        std::size_t k = 0;
+        for (; k < count; ++k)
+        {
+            p = skip_leading_space(p, last);
+            if (p == last)
+            {
+                break;
+            }
+
+            field[k] = p;
+            const char* value_end;
+
+            if (fmt != boost::charconv::chars_format::hex)
+            {
+                bool valid = false;
+                bool too_many_digits = false;
+
+                #ifdef BOOST_CHARCONV_HAS_SSE2
+                valid = parse_number_sse2<false>(p, last, fmt, mantissa[k], exponent[k], negative[k], value_end);
+                if (!valid)
+                #endif
+                {
+                    const auto pns = ff::parse_number_string<char>(p, last, options);
+                    valid = pns.valid;
+                    too_many_digits = pns.too_many_digits;
+                    mantissa[k] = pns.mantissa;
+                    exponent[k] = pns.exponent;
+                    negative[k] = pns.negative;
+                    value_end = pns.lastmatch;
+                }
+
+                if (valid)
+                {
+                    if (too_many_digits)
+                    {
+                        state[k] = field_state::slow;
+                    }
+                    else if (clinger_allowed && mantissa[k] <= format::max_mantissa_fast_path() &&
+                             format::min_exponent_fast_path() <= exponent[k] && exponent[k] <= format::max_exponent_fast_path())
+                    {
+                        state[k] = field_state::clinger;
+                    }
+                    else
+                    {
+                        state[k] = field_state::lemire;
+                    }
+                }
+                else
+                {
+                    // inf, nan, or not a number at all
+                    const auto r = boost::charconv::from_chars(p, last, parsed[k], fmt);
+                    state[k] = r ? field_state::done : field_state::failed;
+                    error[k] = r.ec;
+                    value_end = r.ptr;
+                }
+            }
+            else
+            {
+                // The hex parser needs to be given the field alone
+                const char* field_end = p;
+                while (field_end != last && *field_end != separator && *field_end != '\n')
+                {
+                    ++field_end;
+                }
+                while (field_end != p && is_space(*(field_end - 1)))
+                {
+                    --field_end;
+                }
+
+                const auto r = boost::charconv::from_chars(p, field_end, parsed[k], fmt);
+                state[k] = r || r.ec == std::errc::result_out_of_range ? field_state::done : field_state::failed;
+                error[k] = r.ec;
+                value_end = r.ptr;
+            }
+
+            // A field that holds more than a value fails as a whole
+            const char* next = state[k] == field_state::failed ? nullptr : skip_separator(value_end, last, separator);
+            if (next == nullptr)
+            {
+                state[k] = field_state::failed;
+                error[k] = std::errc::invalid_argument;
+                next = skip_field(value_end, last, separator);
+            }
+            p = next;
+        }
+
+        // Stage 2: compute the values
+        for (std::size_t j = 0; j < k; ++j, ++i)
+        {
+            switch (state[j])
+            {
+                case field_state::clinger:
+                {
+                    BOOST_CHARCONV_STATS_COUNT(from_chars_clinger);
+                    double value = static_cast<double>(mantissa[j]);
+                    if (exponent[j] < 0)
+                    {
+                        value = value / format::exact_power_of_ten(-exponent[j]);
+                    }
+                    else
+                    {
+                        value = value * format::exact_power_of_ten(exponent[j]);
+                    }
+                    values[i] = negative[j] ? -value : value;
+                    break;
+                }
+
+                case field_state::lemire:
+                {
+                    const auto am = ff::compute_float<format>(exponent[j], mantissa[j]);
+                    if (am.power2 >= 0)
+                    {
+                        if ((mantissa[j] != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == format::infinite_power())
+                        {
+                            fail(i, std::errc::result_out_of_range);
+                        }
+                        else
+                        {
+                            BOOST_CHARCONV_STATS_COUNT(from_chars_eisel_lemire);
+                            ff::to_float(negative[j], am, values[i]);
+                        }
+                        break;
+                    }
+                }
+                // The few values that Eisel-Lemire can not decide take the full parser
+                BOOST_FALLTHROUGH;
+
+                case field_state::slow:
+                {
+                    const auto r = boost::charconv::from_chars(field[j], last, values[i], fmt);
+                    if (!r)
+                    {
+                        fail(i, r.ec);
+                    }
+                    break;
+                }
+
+                case field_state::done:
+                    if (error[j] == std::errc())
+                    {
+                        values[i] = parsed[j];
+                    }
+                    else
+                    {
+                        fail(i, error[j]);
+                    }
+                    break;
+
+                case field_state::failed:
+                    fail(i, error[j]);
+                    break;
+            }
+        }
+
+        if (k < count)
+        {
+            // The input ended before n values
+            for (; i < n; ++i)
+            {
+                fail(i, std::errc::invalid_argument);
+            }
+        }
+    }
+
+    result.ptr = p;
+    return result;
+}
+
+namespace {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_padded_float(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    #ifdef BOOST_CHARCONV_HAS_SSE2
+    namespace ff = boost::charconv::detail::fast_float;
+    using format = ff::binary_format<T>;
+
+    std::uint64_t mantissa;
+    std::int64_t exponent;
+    bool negative;
+    const char* end;
+
+    if (first < last && fmt != boost::charconv::chars_format::hex &&
+        parse_number_sse2<true>(first, last, fmt, mantissa, exponent, negative, end))
+    {
+        if (mantissa <= format::max_mantissa_fast_path() && format::min_exponent_fast_path() <= exponent &&
+            exponent <= format::max_exponent_fast_path() && ff::detail::rounds_to_nearest())
+        {
+            BOOST_CHARCONV_STATS_COUNT(from_chars_clinger);
+            T result = static_cast<T>(mantissa);
+            if (exponent < 0)
+            {
+                result = result / format::exact_power_of_ten(-exponent);
+            }
+            else
+            {
+                result = result * format::exact_power_of_ten(exponent);
+            }
+            value = negative ? -result : result;
+            return {end, std::errc()};
+        }
+
+        const auto am = ff::compute_float<format>(exponent, mantissa);
+        if (am.power2 > 0 && am.power2 != format::infinite_power())
+        {
+            BOOST_CHARCONV_STATS_COUNT(from_chars_eisel_lemire);
+            ff::to_float(negative, am, value);
+            return {end, std::errc()};
+        }
+    }
+    #endif
+
+    // Zero, subnormals, out of range values, and everything the SSE2 parser does not take
+    return boost::charconv::from_chars(first, last, value, fmt);
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_padded_float(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_padded_float(first, last, value, fmt);
+}
+
+namespace {
+
+// Eisel-Lemire rounds the first 19 significant digits correctly. from_parsed_number_string only goes on to the big
+// integer comparison of digit_comp when there are more digits and they might change the rounding, so telling it that
+// there are none leaves the value of the 19 digits: the input rounded toward zero, and then to nearest.
+template <typename T>
+boost::charconv::from_chars_result from_chars_fast_approx_impl(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    namespace ff = boost::charconv::detail::fast_float;
+
+    if (first == last || fmt == boost::charconv::chars_format::hex)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto pns = ff::parse_number_string<char>(first, last, ff::parse_options_t<char>{fmt});
+    T result {};
+    boost::charconv::from_chars_result r;
+
+    if (!pns.valid)
+    {
+        if (fmt == boost::charconv::chars_format::json)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        r = ff::detail::parse_infnan(first, last, result);
+    }
+    else
+    {
+        pns.too_many_digits = false;
+        r = ff::from_parsed_number_string(pns, result);
+    }
+
+    if (r)
+    {
+        value = result;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fast_approx(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_fast_approx_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fast_approx(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_fast_approx_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fast_approx(boost::core::string_view sv, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_fast_approx_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_fast_approx(boost::core::string_view sv, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_fast_approx_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
@@ -0,0 +1,172 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/number_reader.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <system_error>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cstddef>
+
+#ifdef BOOST_HAS_UNISTD_H
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+inline std::error_code errno_code() noexcept
+{
+    return std::error_code(errno, std::generic_category());
+}
+
+// Reads everything that read(buffer, size) returns into a buffer with from_chars_padding characters of slack.
+// read returns the number of characters read, 0 at the end, and a negative number on errors.
+template <typename Read>
+std::error_code read_whole_file(boost::charconv::detail::file_region& region, Read read) noexcept
+{
+    constexpr std::size_t padding = boost::charconv::from_chars_padding;
+
+    std::size_t capacity = 65536;
+    std::size_t size = 0;
+    char* buffer = static_cast<char*>(std::malloc(capacity + padding));
+
+    for (;;)
+    {
+        if (buffer == nullptr)
+        {
+            return std::make_error_code(std::errc::not_enough_memory);
+        }
+
+        const std::ptrdiff_t n = read(buffer + size, capacity - size);
+        if (n < 0)
+        {
+            const auto ec = errno != 0 ? errno_code() : std::make_error_code(std::errc::io_error);
+            std::free(buffer);
+            return ec;
+        }
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        size += static_cast<std::size_t>(n);
+        if (size == capacity)
+        {
+            capacity *= 2;
+            char* const larger = static_cast<char*>(std::realloc(buffer, capacity + padding));
+            if (larger == nullptr)
+            {
+                std::free(buffer);
+            }
+            buffer = larger;
+        }
+    }
+
+    // The slack is never part of a value, but is read
+    std::memset(buffer + size, 0, padding);
+    region = boost::charconv::detail::file_region {buffer, size, padding, false};
+    return {};
+}
+
+} // Namespace
+
+#ifdef BOOST_HAS_UNISTD_H
+
+// Regular files are mapped, and the rest of the last page is the padding. When the size is a multiple of the
+// page size there is none, and number_reader reads the end of the file with from_chars. Pipes and the like are
+// read into memory instead.
+std::error_code boost::charconv::detail::open_file_region(int fd, boost::charconv::detail::file_region& region) noexcept
+{
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        return errno_code();
+    }
+
+    if (S_ISREG(st.st_mode) && st.st_size > 0 && static_cast<unsigned long long>(st.st_size) <= static_cast<std::size_t>(-1))
+    {
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            #ifdef MADV_SEQUENTIAL
+            ::madvise(data, size, MADV_SEQUENTIAL);
+            #endif
+
+            const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            const std::size_t tail = size % page_size;
+            region = file_region {static_cast<const char*>(data), size, tail == 0 ? 0 : page_size - tail, true};
+            return {};
+        }
+    }
+
+    return read_whole_file(region, [fd](char* buffer, std::size_t size) noexcept -> std::ptrdiff_t {
+        ssize_t n;
+        do
+        {
+            n = ::read(fd, buffer, size);
+        } while (n < 0 && errno == EINTR);
+
+        return static_cast<std::ptrdiff_t>(n);
+    });
+}
+
+std::error_code boost::charconv::detail::open_file_region(const char* path, boost::charconv::detail::file_region& region) noexcept
+{
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return errno_code();
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    const auto ec = open_file_region(fd, region);
+    ::close(fd);
+    return ec;
+}
+
+void boost::charconv::detail::close_file_region(boost::charconv::detail::file_region& region) noexcept
+{
+    if (region.mapped)
+    {
+        ::munmap(const_cast<char*>(region.data), region.size);
+    }
+    else
+    {
+        std::free(const_cast<char*>(region.data));
+    }
+}
+
+#else
+
+std::error_code boost::charconv::detail::open_file_region(const char* path, boost::charconv::detail::file_region& region) noexcept
+{
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return errno_code();
+    }
+
+    const auto ec = read_whole_file(region, [file](char* buffer, std::size_t size) noexcept -> std::ptrdiff_t {
+        errno = 0;
+        const std::size_t n = std::fread(buffer, 1, size, file);
+        return n == 0 && std::ferror(file) ? -1 : static_cast<std::ptrdiff_t>(n);
+    });
+
+    std::fclose(file);
+    return ec;
+}
+
+void boost::charconv::detail::close_file_region(boost::charconv::detail::file_region& region) noexcept
+{
+    std::free(const_cast<char*>(region.data));
+}
+
+#endif
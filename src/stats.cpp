@@ -0,0 +1,114 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/stats.hpp>
+#include <boost/charconv/detail/stats.hpp>
+#include <cstdint>
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS
+
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+using boost::charconv::detail::stats_counter;
+
+constexpr std::size_t counter_count = static_cast<std::size_t>(stats_counter::count);
+
+// The counters of a thread. Only the thread itself writes them, so adding one is a relaxed load and store rather
+// than a locked read-modify-write, and stats() reads them from other threads with relaxed loads.
+struct thread_counters
+{
+    std::atomic<std::uint64_t> values[counter_count];
+    thread_counters* next;
+
+    thread_counters() noexcept;
+    ~thread_counters();
+};
+
+// The counters of the running threads, and the sums of those of the threads that have exited
+std::mutex registry_mutex;
+thread_counters* registry_head = nullptr;
+std::uint64_t exited_sums[counter_count] = {};
+
+thread_counters::thread_counters() noexcept
+{
+    for (auto& value : values)
+    {
+        value.store(0, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    next = registry_head;
+    registry_head = this;
+}
+
+thread_counters::~thread_counters()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (std::size_t i = 0; i < counter_count; ++i)
+    {
+        exited_sums[i] += values[i].load(std::memory_order_relaxed);
+    }
+
+    thread_counters** p = &registry_head;
+    while (*p != this)
+    {
+        p = &(*p)->next;
+    }
+    *p = next;
+}
+
+} // Namespace
+
+void boost::charconv::detail::count_stat(stats_counter counter) noexcept
+{
+    static thread_local thread_counters counters;
+
+    auto& value = counters.values[static_cast<std::size_t>(counter)];
+    value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+boost::charconv::stats_snapshot boost::charconv::stats() noexcept
+{
+    std::uint64_t sums[counter_count];
+
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        for (std::size_t i = 0; i < counter_count; ++i)
+        {
+            sums[i] = exited_sums[i];
+        }
+
+        for (const thread_counters* p = registry_head; p != nullptr; p = p->next)
+        {
+            for (std::size_t i = 0; i < counter_count; ++i)
+            {
+                sums[i] += p->values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    const auto sum = [&](stats_counter counter) { return sums[static_cast<std::size_t>(counter)]; };
+
+    stats_snapshot snapshot;
+    snapshot.enabled = true;
+    snapshot.from_chars_clinger = sum(stats_counter::from_chars_clinger);
+    snapshot.from_chars_eisel_lemire = sum(stats_counter::from_chars_eisel_lemire);
+    snapshot.from_chars_digit_comparison = sum(stats_counter::from_chars_digit_comparison);
+    snapshot.from_chars_strtod = sum(stats_counter::from_chars_strtod);
+    snapshot.from_chars_strtod_malloc = sum(stats_counter::from_chars_strtod_malloc);
+    snapshot.to_chars_printf = sum(stats_counter::to_chars_printf);
+    return snapshot;
+}
+
+#else
+
+boost::charconv::stats_snapshot boost::charconv::stats() noexcept
+{
+    return {};
+}
+
+#endif
@@ -7,13 +7,23 @@
 #include "float128_impl.hpp"
 #include "to_chars_float_impl.hpp"
 #include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/number_writer.hpp>
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv/decimal_parts.hpp>
+#include <boost/charconv/digit_generator.hpp>
+#include <boost/charconv/detail/exact_digits.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/core/bit.hpp>
 #include <limits>
 #include <cstring>
 #include <cstdio>
 #include <cstdint>
 #include <cmath>
 
+#ifdef BOOST_CHARCONV_HAS_SSE2
+#  include <emmintrin.h>
+#endif
+
 namespace boost { namespace charconv { namespace detail { namespace to_chars_detail {
 
 #ifdef BOOST_MSVC
@@ -57,6 +67,30 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
         std::memcpy(buffer, radix_table + n * 2, 2);
     }
 
+    // Longest output for at most max_digits significant digits: the digits, the decimal point, and the exponent
+    // of the first digit, which is always printed with at least two digits
+    static std::ptrdiff_t print_chars_length(int max_digits, int exponent) noexcept
+    {
+        return max_digits + 3 + (exponent <= -100 || exponent >= 100 ? 3 : 2);
+    }
+
+    // The printers write all of the digits before they drop the trailing zeros, so when the buffer can not hold
+    // print_chars_length characters the output goes to a scratch buffer, and is copied if it fits
+    template <typename Float>
+    to_chars_result print_chars_via_scratch(typename dragonbox_float_traits<Float>::carrier_uint significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+    {
+        char scratch[32];
+        const auto r = dragon_box_print_chars<Float, dragonbox_float_traits<Float>>(significand, exponent, scratch, scratch + sizeof(scratch), fmt);
+        const std::ptrdiff_t length = r.ptr - scratch;
+        if (length > last - first)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(first, scratch, static_cast<std::size_t>(length));
+        return {first + length, std::errc()};
+    }
+
     // These digit generation routines are inspired by James Anhalt's itoa algorithm:
     // https://github.com/jeaiii/itoa
     // The main idea is for given n, find y such that floor(10^k * y / 2^32) = n holds,
@@ -268,14 +302,13 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
     template <>
     to_chars_result dragon_box_print_chars<float, dragonbox_float_traits<float>>(std::uint32_t s32, int exponent, char* first, char* last, chars_format fmt) noexcept
     {
-        auto buffer = first;
-
-        const std::ptrdiff_t total_length = total_buffer_length(9, exponent, false);
-        if (total_length > (last - first))
+        if (print_chars_length(9, exponent + num_digits(s32) - 1) > (last - first))
         {
-            return {last, std::errc::value_too_large};
+            return print_chars_via_scratch<float>(s32, exponent, first, last, fmt);
         }
 
+        auto buffer = first;
+
         // Print significand.
         print_9_digits(s32, exponent, buffer);
 
@@ -309,8 +342,9 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
     }
 
     template <>
-    to_chars_result dragon_box_print_chars<double, dragonbox_float_traits<double>>(const std::uint64_t significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+    to_chars_result dragon_box_print_chars<double, dragonbox_float_traits<double>>(const std::uint64_t significand, const int exponent_in, char* first, char* last, chars_format fmt) noexcept
     {
+        int exponent = exponent_in;
         auto buffer = first;
 
         // Print significand by decomposing it into a 9-digit block and a 8-digit block.
@@ -331,10 +365,9 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
             no_second_block = true;
         }
 
-        const std::ptrdiff_t total_length = total_buffer_length(no_second_block ? 9 : 17, exponent, false);;
-        if (total_length > (last - first))
+        if (print_chars_length(no_second_block ? 9 : 17, exponent + num_digits(first_block) - 1) > (last - first))
         {
-            return {last, std::errc::value_too_large};
+            return print_chars_via_scratch<double>(significand, exponent_in, first, last, fmt);
         }
 
         if (no_second_block)
@@ -583,6 +616,311 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
     return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
 }
 
+namespace {
+
+#ifdef BOOST_CHARCONV_HAS_SSE2
+
+// The 8 digits of value < 10^8, including leading zeros, as 16-bit lanes with the first digit in the lowest lane.
+// Splits into 4 digit halves, then divides copies of each half by 1000, 100, 10, and 1 with multiply-high in all
+// lanes at once, and subtracts 10 times the neighbouring lane (the itoa method of Wojciech Mula).
+BOOST_FORCEINLINE __m128i digits_8_lanes(std::uint32_t value) noexcept
+{
+    const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(value));
+    // abcd = value / 10000 with 0xD1B71759 = ceil(2^45 / 10000)
+    const __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, _mm_set1_epi32(static_cast<int>(0xD1B71759))), 45);
+    const __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+
+    const __m128i v1 = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+    const __m128i v2 = _mm_unpacklo_epi32(_mm_unpacklo_epi16(v1, v1), _mm_unpacklo_epi16(v1, v1));
+    // The multipliers are unsigned, -32768 stands for 0x8000
+    const __m128i v3 = _mm_mulhi_epu16(v2, _mm_setr_epi16(8389, 5243, 13108, -32768,
+                                                          8389, 5243, 13108, -32768));
+    const __m128i v4 = _mm_mulhi_epu16(v3, _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768,
+                                                          1 << 7, 1 << 11, 1 << 13, -32768));
+    return _mm_sub_epi16(v4, _mm_slli_epi64(_mm_mullo_epi16(v4, _mm_set1_epi16(10)), 16));
+}
+
+#else
+
+// The 8 digits of value < 10^8, including leading zeros, as one byte each (0 to 9) with the first digit in the
+// lowest byte. Splits into 4, 2, and 1 digit lanes with multiplications, so nothing goes through memory.
+BOOST_FORCEINLINE std::uint64_t digits_8_word(std::uint32_t value) noexcept
+{
+    // x / 100 for x < 10000 is (x * 10486) >> 20, and x / 10 for x < 100 is (x * 103) >> 10
+    const std::uint64_t x = (value / 10000) | (static_cast<std::uint64_t>(value % 10000) << 32);
+    const std::uint64_t hundreds = ((x * 10486) >> 20) & UINT64_C(0x0000007F0000007F);
+    const std::uint64_t y = hundreds | ((x - hundreds * 100) << 16);
+    const std::uint64_t tens = ((y * 103) >> 10) & UINT64_C(0x000F000F000F000F);
+    return tens | ((y - tens * 10) << 8);
+}
+
+// Number of zero digits at the end of a word from digits_8_word
+BOOST_FORCEINLINE int trailing_zero_digits(std::uint64_t word) noexcept
+{
+    return word == 0 ? 8 : boost::core::countl_zero(word) / 8;
+}
+
+#endif
+
+// Writes the 16 digits of value < 10^16, including leading zeros, and returns how many of them are trailing zeros.
+// Only for little endian targets.
+BOOST_FORCEINLINE int print_16_digits_padded(std::uint64_t value, char* buffer) noexcept
+{
+    const auto high = static_cast<std::uint32_t>(value / 100000000);
+    const auto low = static_cast<std::uint32_t>(value - static_cast<std::uint64_t>(high) * 100000000);
+
+    #ifdef BOOST_CHARCONV_HAS_SSE2
+
+    const __m128i digits = _mm_packus_epi16(digits_8_lanes(high), digits_8_lanes(low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm_add_epi8(digits, _mm_set1_epi8('0')));
+
+    // Bit i is set when digit i is zero, so the trailing zeros are the run of ones that ends at bit 15
+    const auto zero_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(digits, _mm_setzero_si128())));
+    return boost::core::countl_zero(~(zero_mask << 16));
+
+    #else
+
+    const std::uint64_t high_digits = digits_8_word(high);
+    const std::uint64_t low_digits = digits_8_word(low);
+    const std::uint64_t high_chars = high_digits + UINT64_C(0x3030303030303030);
+    const std::uint64_t low_chars = low_digits + UINT64_C(0x3030303030303030);
+    std::memcpy(buffer, &high_chars, sizeof(high_chars));
+    std::memcpy(buffer + 8, &low_chars, sizeof(low_chars));
+
+    const int low_zeros = trailing_zero_digits(low_digits);
+    return low_zeros == 8 ? 8 + trailing_zero_digits(high_digits) : low_zeros;
+
+    #endif
+}
+
+// Same output as dragon_box_print_chars for double, without branching on the number of digits: the significand
+// is scaled to exactly 17 digits so every digit has a fixed position, and the zeros that were added end up with
+// the trailing zeros that are dropped anyway. Writes up to 23 characters past first whatever the output length.
+BOOST_FORCEINLINE char* print_scientific_unchecked(char* first, std::uint64_t significand, int exponent,
+                                                   boost::charconv::chars_format fmt) noexcept
+{
+    using namespace boost::charconv::detail;
+
+    BOOST_CHARCONV_ASSERT(significand != 0 && significand < UINT64_C(100000000000000000));
+
+    // Number of digits from the bit width, corrected by one comparison
+    const auto approx = static_cast<std::size_t>((64 - boost::core::countl_zero(significand)) * 1233 >> 12);
+    const int num_dig = static_cast<int>(approx) + static_cast<int>(significand >= powers_of_10[approx]);
+
+    const std::uint64_t normalized = significand * powers_of_10[static_cast<std::size_t>(17 - num_dig)];
+    const std::uint64_t first_digit = normalized / UINT64_C(10000000000000000);
+    first[0] = static_cast<char>('0' + first_digit);
+    first[1] = '.';
+    const int kept = 17 - print_16_digits_padded(normalized - first_digit * UINT64_C(10000000000000000), first + 2);
+    first += kept == 1 ? 1 : kept + 1;
+
+    exponent += num_dig - 1;
+    if (exponent == 0 && fmt != boost::charconv::chars_format::scientific)
+    {
+        return first;
+    }
+
+    // Three exponent digits are rare enough to be a misprediction every time, so the hundreds are
+    // always written and overwritten by the other two digits when there are only two
+    first[0] = 'e';
+    first[1] = exponent < 0 ? '-' : '+';
+    const auto abs_exponent = static_cast<std::uint32_t>(exponent < 0 ? -exponent : exponent);
+    const auto three_digits = static_cast<std::size_t>(abs_exponent >= 100);
+    first[2] = static_cast<char>('0' + abs_exponent / 100);
+    std::memcpy(first + 2 + three_digits, radix_table + (abs_exponent % 100) * 2, 2);
+    return first + 4 + three_digits;
+}
+
+// Prints a finite, non-zero double from the decimal that dragonbox computed for it (trailing zeros not removed),
+// choosing between the layouts exactly like to_chars_float_impl does for the shortest representation.
+// may_write_past_end allows the faster scientific writer, which leaves scratch characters after its output.
+BOOST_FORCEINLINE boost::charconv::to_chars_result to_chars_shortest_decimal(char* first, char* last, double value,
+                                                                             std::uint64_t significand, int exponent,
+                                                                             boost::charconv::chars_format fmt,
+                                                                             bool may_write_past_end) noexcept
+{
+    using namespace boost::charconv::detail;
+
+    if (first >= last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    const double abs_value = std::fabs(value);
+    const bool fixed_layout = fmt == boost::charconv::chars_format::fixed ||
+                              (fmt == boost::charconv::chars_format::general && abs_value > 1e-5 && abs_value < 1e16);
+
+    if (fixed_layout)
+    {
+        while (significand % 10 == 0)
+        {
+            significand /= 10;
+            ++exponent;
+        }
+
+        return to_chars_fixed_decimal(first, last, significand, exponent, value < 0);
+    }
+
+    if (value < 0)
+    {
+        *first++ = '-';
+    }
+
+    if (fmt == boost::charconv::chars_format::general && abs_value >= 1e16 &&
+        abs_value < static_cast<double>((std::numeric_limits<std::uint64_t>::max)()))
+    {
+        return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(abs_value));
+    }
+
+    // The digits are assembled in little endian words. The longest output is 1.2345678901234567e-308, and the
+    // unchecked writer needs a few characters of slack
+    #if BOOST_CHARCONV_ENDIAN_LITTLE_BYTE
+    if (may_write_past_end && last - first >= 32)
+    {
+        return {print_scientific_unchecked(first, significand, exponent, fmt), std::errc()};
+    }
+    #endif
+
+    return to_chars_detail::dragon_box_print_chars<double, dragonbox_float_traits<double>>(significand, exponent, first, last, fmt);
+}
+
+} // Namespace
+
+// The values are handled in blocks: first dragonbox computes the decimal of every value in the block, so the
+// multiplications of independent values overlap instead of each waiting for the digits of the previous one to be
+// stored, and then the block is printed. Zeros, non-finite values and hex go through the regular to_chars.
+boost::charconv::to_chars_result boost::charconv::to_chars_n(char* first, char* last, const double* values, std::size_t n,
+                                                             boost::charconv::chars_format fmt, char separator) noexcept
+{
+    using namespace boost::charconv::detail;
+
+    fmt = output_format(fmt);
+
+    constexpr std::size_t block_size = 32;
+
+    // print_scientific_unchecked leaves up to 23 characters of scratch after its output. Every later value writes at
+    // least a separator and a digit, so after 12 more values nothing of it is left past the end of the output.
+    constexpr std::size_t unchecked_tail = 12;
+
+    std::uint64_t significands[block_size];
+    int exponents[block_size];
+
+    for (std::size_t block = 0; block < n; block += block_size)
+    {
+        const std::size_t count = n - block < block_size ? n - block : block_size;
+        const double* block_values = values + block;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto br = dragonbox_float_bits<double>(block_values[i]);
+            const auto exponent_bits = br.extract_exponent_bits();
+
+            significands[i] = 0;
+            if (br.is_finite(exponent_bits) && br.is_nonzero() && fmt != chars_format::hex)
+            {
+                const auto decimal = to_decimal<double, dragonbox_float_traits<double>>(br.remove_exponent_bits(exponent_bits), exponent_bits,
+                                                                                        policy::sign::ignore, policy::trailing_zero::ignore);
+                significands[i] = decimal.significand;
+                exponents[i] = decimal.exponent;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (block + i != 0)
+            {
+                if (first >= last)
+                {
+                    return {last, std::errc::value_too_large};
+                }
+                *first++ = separator;
+            }
+
+            const auto r = significands[i] == 0 ? to_chars_float_impl(first, last, block_values[i], fmt, -1) :
+                                                  to_chars_shortest_decimal(first, last, block_values[i], significands[i], exponents[i], fmt,
+                                                                            block + i + unchecked_tail < n);
+            if (r.ec != std::errc())
+            {
+                return r;
+            }
+            first = r.ptr;
+        }
+    }
+
+    return {first, std::errc()};
+}
+
+// Follows the layouts of to_chars_shortest_decimal with chars_format::general: fixed for 1e-5 < |value| < 1e16,
+// the integer for values up to 2^64, and scientific otherwise. Zeros and non-finite values are printed to measure them.
+std::size_t boost::charconv::detail::shortest_chars_length(const double* values, std::size_t n) noexcept
+{
+    std::size_t length = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double value = values[i];
+        const auto br = dragonbox_float_bits<double>(value);
+        const auto exponent_bits = br.extract_exponent_bits();
+
+        if (BOOST_UNLIKELY(!br.is_finite(exponent_bits) || !br.is_nonzero()))
+        {
+            char buffer[max_shortest_chars];
+            length += static_cast<std::size_t>(to_chars_float_impl(buffer, buffer + sizeof(buffer), value, chars_format::general, -1).ptr - buffer);
+            continue;
+        }
+
+        const auto decimal = to_decimal<double, dragonbox_float_traits<double>>(br.remove_exponent_bits(exponent_bits), exponent_bits,
+                                                                                policy::sign::ignore, policy::trailing_zero::remove);
+        const int num_dig = num_digits(decimal.significand);
+        const int exponent = decimal.exponent;
+        const double abs_value = std::fabs(value);
+
+        int chars = static_cast<int>(value < 0);
+        if (abs_value > 1e-5 && abs_value < 1e16)
+        {
+            // ddd000, dd.ddd, or 0.000ddd
+            chars += exponent >= 0 ? num_dig + exponent : (-exponent < num_dig ? num_dig + 1 : 2 - exponent);
+        }
+        else if (abs_value >= 1e16 && abs_value < static_cast<double>((std::numeric_limits<std::uint64_t>::max)()))
+        {
+            chars += num_digits(static_cast<std::uint64_t>(abs_value));
+        }
+        else
+        {
+            // d.ddde+dd with at least two exponent digits
+            const int scientific_exponent = exponent + num_dig - 1;
+            const int abs_exponent = scientific_exponent < 0 ? -scientific_exponent : scientific_exponent;
+            chars += (num_dig == 1 ? 1 : num_dig + 1) + (abs_exponent >= 100 ? 5 : 4);
+        }
+
+        length += static_cast<std::size_t>(chars);
+    }
+
+    return length;
+}
+
+// The room that number_writer reserves is enough for the scratch characters of the scientific writer
+char* boost::charconv::detail::to_chars_unchecked(char* first, double value, boost::charconv::chars_format fmt) noexcept
+{
+    fmt = output_format(fmt);
+    const auto br = dragonbox_float_bits<double>(value);
+    const auto exponent_bits = br.extract_exponent_bits();
+    char* const last = first + max_shortest_chars_for(fmt);
+
+    if (!br.is_finite(exponent_bits) || !br.is_nonzero() || fmt == chars_format::hex)
+    {
+        return to_chars_float_impl(first, last, value, fmt, -1).ptr;
+    }
+
+    const auto decimal = to_decimal<double, dragonbox_float_traits<double>>(br.remove_exponent_bits(exponent_bits), exponent_bits,
+                                                                            policy::sign::ignore, policy::trailing_zero::ignore);
+    return to_chars_shortest_decimal(first, last, value, decimal.significand, decimal.exponent, fmt, true).ptr;
+}
+
+char* boost::charconv::detail::to_chars_unchecked(char* first, double value, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_float_impl(first, first + max_precision_chars_for(fmt, precision), value, fmt, precision).ptr;
+}
+
 #if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
 
 boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* last, long double value,
@@ -753,3 +1091,134 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
     return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<float>(value), fmt, precision);
 }
 #endif
+
+namespace {
+
+template <typename T>
+std::errc to_decimal_impl(T value, boost::charconv::decimal_parts<std::uint64_t>& parts) noexcept
+{
+    if (!std::isfinite(value))
+    {
+        return std::errc::invalid_argument;
+    }
+
+    parts.sign = std::signbit(value);
+    parts.truncated = false;
+
+    if (value == 0)
+    {
+        parts.significand = 0;
+        parts.exponent = 0;
+        parts.digits = 0;
+        return std::errc();
+    }
+
+    const auto dec = boost::charconv::detail::to_decimal(value);
+    parts.significand = dec.significand;
+    parts.exponent = dec.exponent;
+    parts.digits = boost::charconv::detail::num_digits(dec.significand);
+
+    return std::errc();
+}
+
+}
+
+std::errc boost::charconv::to_decimal(float value, boost::charconv::decimal_parts<std::uint64_t>& parts) noexcept
+{
+    return to_decimal_impl(value, parts);
+}
+
+std::errc boost::charconv::to_decimal(double value, boost::charconv::decimal_parts<std::uint64_t>& parts) noexcept
+{
+    return to_decimal_impl(value, parts);
+}
+
+int boost::charconv::detail::generate_digits(double value, int count, char* first) noexcept
+{
+    // floff's first segment is computed at a fixed position, and is too short to be split correctly for subnormals
+    if (value != 0 && value < (std::numeric_limits<double>::min)())
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(value));
+        return boost::charconv::detail::exact_digits<boost::charconv::detail::exact_digits_limbs(1074)>(
+            0, bits, -1074, count, first).exponent;
+    }
+
+    const auto r = boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                  boost::charconv::detail::floff_extended_cache>(
+        value, count - 1, first, first + count + 8, boost::charconv::chars_format::scientific);
+    BOOST_CHARCONV_ASSERT(r.ec == std::errc());
+
+    // Output is d.ddde+XX, so drop the decimal point and read back the exponent
+    const char* exp_pos = first + 1;
+    if (count > 1)
+    {
+        std::memmove(first + 1, first + 2, static_cast<std::size_t>(count - 1));
+        exp_pos = first + count + 1;
+    }
+
+    BOOST_CHARCONV_ASSERT(*exp_pos == 'e');
+    const bool negative_exponent = exp_pos[1] == '-';
+    int exponent = 0;
+    for (const char* p = exp_pos + 2; p != r.ptr; ++p)
+    {
+        exponent = exponent * 10 + (*p - '0');
+    }
+
+    return negative_exponent ? -exponent : exponent;
+}
+
+namespace {
+
+template <typename UC>
+void widen_chars_impl(const char* first, const char* last, UC* out) noexcept
+{
+    static_assert(sizeof(UC) == 2 || sizeof(UC) == 4, "Output characters must be 16 or 32 bits wide");
+
+    #ifdef BOOST_CHARCONV_HAS_SSE2
+    // Zero extends 16 characters at a time by interleaving them with zero bytes
+    const __m128i zero = _mm_setzero_si128();
+    for (; last - first >= 16; first += 16, out += 16)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i low = _mm_unpacklo_epi8(chars, zero);
+        const __m128i high = _mm_unpackhi_epi8(chars, zero);
+        auto dest = reinterpret_cast<__m128i*>(out);
+
+        BOOST_IF_CONSTEXPR (sizeof(UC) == 2)
+        {
+            _mm_storeu_si128(dest, low);
+            _mm_storeu_si128(dest + 1, high);
+        }
+        else
+        {
+            _mm_storeu_si128(dest, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(high, zero));
+        }
+    }
+    #endif
+
+    for (; first != last; ++first, ++out)
+    {
+        *out = static_cast<UC>(static_cast<unsigned char>(*first));
+    }
+}
+
+} // namespace
+
+void boost::charconv::detail::widen_chars(const char* first, const char* last, wchar_t* out) noexcept
+{
+    widen_chars_impl(first, last, out);
+}
+
+void boost::charconv::detail::widen_chars(const char* first, const char* last, char16_t* out) noexcept
+{
+    widen_chars_impl(first, last, out);
+}
+
+void boost::charconv::detail::widen_chars(const char* first, const char* last, char32_t* out) noexcept
+{
+    widen_chars_impl(first, last, out);
+}
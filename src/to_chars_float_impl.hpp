@@ -20,6 +20,8 @@
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/fallback_routines.hpp>
 #include <boost/charconv/detail/buffer_sizing.hpp>
+#include <boost/charconv/detail/exact_digits.hpp>
+#include <boost/charconv/detail/to_chars_16_bit.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
@@ -48,6 +50,12 @@ namespace boost {
 namespace charconv {
 namespace detail {
 
+// chars_format::json only restricts what from_chars accepts, and is printed as general
+constexpr chars_format output_format(chars_format fmt) noexcept
+{
+    return fmt == chars_format::json ? chars_format::general : fmt;
+}
+
 template <typename Real>
 inline to_chars_result to_chars_nonfinite(char* first, char* last, Real value, int classification) noexcept;
 
@@ -544,132 +552,484 @@ to_chars_result to_chars_hex(char* first, char* last, Real value, int precision)
 # pragma warning(pop)
 #endif
 
+// Splits a finite value into its sign and (hi * 2^64 + lo) * 2^e without depending on its bit layout.
+// Returns the largest |e| the type can produce, which sizes the arbitrary precision arithmetic
 template <typename Real>
-to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+constexpr int exact_max_exponent(Real) noexcept
 {
-    const std::ptrdiff_t buffer_size = last - first;
-    auto real_precision = get_real_precision<Real>(precision);
-    if (buffer_size < real_precision || first > last)
+    return std::numeric_limits<Real>::digits - std::numeric_limits<Real>::min_exponent + 127;
+}
+
+template <typename Real>
+inline bool exact_decompose(Real value, std::uint64_t& hi, std::uint64_t& lo, int& e) noexcept
+{
+    const bool is_negative = std::signbit(value);
+    hi = 0;
+    lo = 0;
+    e = 0;
+
+    if (value != 0)
+    {
+        int exp {};
+        Real m = std::ldexp(std::frexp(std::fabs(value), &exp), 64);
+        hi = static_cast<std::uint64_t>(m);
+        m = std::ldexp(m - static_cast<Real>(hi), 64);
+        lo = static_cast<std::uint64_t>(m);
+        e = exp - 128;
+    }
+
+    return is_negative;
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+
+// frexpq and ldexpq live in libquadmath, so take the bits apart instead
+constexpr int exact_max_exponent(__float128) noexcept
+{
+    return 16494;
+}
+
+inline bool exact_decompose(__float128 value, std::uint64_t& hi, std::uint64_t& lo, int& e) noexcept
+{
+    words128 bits;
+    std::memcpy(&bits, &value, sizeof(value));
+
+    const auto biased_exponent = static_cast<int>((bits.hi >> 48) & UINT64_C(0x7FFF));
+    hi = bits.hi & UINT64_C(0x0000FFFFFFFFFFFF);
+    lo = bits.lo;
+
+    if (biased_exponent != 0)
+    {
+        hi |= UINT64_C(1) << 48;
+        e = biased_exponent - 16383 - 112;
+    }
+    else
+    {
+        e = 1 - 16383 - 112;
+    }
+
+    return (bits.hi >> 63) != 0;
+}
+
+#endif
+
+inline to_chars_result to_chars_exact_exponent(char* first, char* last, int exponent) noexcept
+{
+    if (last - first < 4)
     {
         return {last, std::errc::value_too_large};
     }
 
-    auto abs_value = std::abs(value);
+    *first++ = 'e';
+    *first++ = exponent < 0 ? '-' : '+';
+    const auto abs_exponent = static_cast<std::uint32_t>(exponent < 0 ? -exponent : exponent);
+    if (abs_exponent < 10)
+    {
+        *first++ = '0';
+    }
+
+    return to_chars_int(first, last, abs_exponent);
+}
+
+// Formats value with a specified precision from its exact decimal expansion, giving the same output as printf.
+// This is much slower than floff, so it is only used for the types and ranges floff does not support.
+template <typename Real>
+to_chars_result to_chars_exact_impl(char* first, char* last, Real value, chars_format fmt, int precision) noexcept
+{
+    constexpr auto max_limbs = exact_digits_limbs(exact_max_exponent(Real()));
 
-    auto value_struct = boost::charconv::detail::to_decimal(value);
-    if (value_struct.is_negative)
+    if (first >= last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::uint64_t hi;
+    std::uint64_t lo;
+    int e;
+    if (exact_decompose(value, hi, lo, e))
     {
         *first++ = '-';
     }
 
-    if (value_struct.significand == 0)
+    const bool is_zero = hi == 0 && lo == 0;
+
+    const std::ptrdiff_t buffer_size = last - first;
+    const int capacity = buffer_size > INT_MAX ? INT_MAX : static_cast<int>(buffer_size);
+
+    if (fmt == chars_format::scientific)
     {
-        *first++ = '0';
-        if (precision > -1)
+        const int num_dig = precision + 1;
+        if (capacity < num_dig + (precision > 0 ? 1 : 0))
         {
-            *first++ = '.';
-            std::memset(first, '0', static_cast<std::size_t>(precision));
-            first += precision;
+            return {last, std::errc::value_too_large};
         }
 
-        return {first, std::errc()};
-    }
+        int exponent = 0;
+        if (is_zero)
+        {
+            std::memset(first, '0', static_cast<std::size_t>(num_dig));
+        }
+        else
+        {
+            exponent = exact_digits<max_limbs>(hi, lo, e, num_dig, first).exponent;
+        }
 
-    const int starting_num_digits = num_digits(value_struct.significand);
-    int num_dig = starting_num_digits;
-    if (precision != -1)
+        if (precision > 0)
+        {
+            std::memmove(first + 2, first + 1, static_cast<std::size_t>(precision));
+            first[1] = '.';
+            ++first;
+        }
+
+        return to_chars_exact_exponent(first + num_dig, last, exponent);
+    }
+    else if (fmt == chars_format::fixed)
     {
-        while (num_dig > precision + 2)
+        int exponent = -1;
+        int num_dig = 0;
+        if (!is_zero)
+        {
+            exponent = exact_digits<max_limbs>(hi, lo, e, precision, first, true, capacity).exponent;
+            num_dig = exponent + 1 + precision;
+        }
+
+        if (exponent >= 0)
+        {
+            // Integer part followed by precision digits
+            const int total_length = num_dig + (precision > 0 ? 1 : 0);
+            if (total_length > capacity)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            if (precision > 0)
+            {
+                std::memmove(first + exponent + 2, first + exponent + 1, static_cast<std::size_t>(precision));
+                first[exponent + 1] = '.';
+            }
+
+            return {first + total_length, std::errc()};
+        }
+
+        // 0.000ddd with num_dig non-zero digits, if any survived rounding
+        const int total_length = precision > 0 ? precision + 2 : 1;
+        if (total_length > capacity)
         {
-            value_struct.significand /= 10;
-            ++value_struct.exponent;
-            --num_dig;
+            return {last, std::errc::value_too_large};
         }
 
-        if (num_dig == precision + 2)
+        if (num_dig < 0)
         {
-            const auto trailing_dig = value_struct.significand % 10;
-            value_struct.significand /= 10;
-            ++value_struct.exponent;
-            --num_dig;
+            num_dig = 0;
+        }
 
-            if (trailing_dig >= 5)
+        if (precision > 0)
+        {
+            std::memmove(first + 2 + precision - num_dig, first, static_cast<std::size_t>(num_dig));
+            std::memcpy(first, "0.", 2U); // NOLINT : No null terminator is purposeful
+            std::memset(first + 2, '0', static_cast<std::size_t>(precision - num_dig));
+        }
+        else
+        {
+            *first = '0';
+        }
+
+        return {first + total_length, std::errc()};
+    }
+
+    // General: precision significant digits without trailing zeros, in fixed notation
+    // if the exponent is in [-4, precision) and in scientific notation otherwise
+    if (precision == 0)
+    {
+        precision = 1;
+    }
+
+    if (is_zero)
+    {
+        *first = '0';
+        return {first + 1, std::errc()};
+    }
+
+    const auto r = exact_digits<max_limbs>(hi, lo, e, precision, first, false, capacity);
+    if (r.overflow)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    const int exponent = r.exponent;
+    int num_dig = precision < capacity ? precision : capacity;
+    while (num_dig > 1 && first[num_dig - 1] == '0')
+    {
+        --num_dig;
+    }
+
+    if (exponent < -4 || exponent >= precision)
+    {
+        if (num_dig > 1)
+        {
+            if (num_dig + 1 > capacity)
             {
-                ++value_struct.significand;
+                return {last, std::errc::value_too_large};
             }
+
+            std::memmove(first + 2, first + 1, static_cast<std::size_t>(num_dig - 1));
+            first[1] = '.';
+            ++first;
         }
 
-        // In general formatting we remove trailing 0s
-        if (fmt == chars_format::general)
+        return to_chars_exact_exponent(first + num_dig, last, exponent);
+    }
+    else if (exponent >= 0)
+    {
+        if (num_dig <= exponent + 1)
         {
-            while (value_struct.significand % 10 == 0)
+            // Integer, so pad up to the decimal point
+            if (exponent + 1 > capacity)
             {
-                value_struct.significand /= 10;
-                ++value_struct.exponent;
-                --num_dig;
+                return {last, std::errc::value_too_large};
             }
+
+            std::memset(first + num_dig, '0', static_cast<std::size_t>(exponent + 1 - num_dig));
+            return {first + exponent + 1, std::errc()};
+        }
+
+        if (num_dig + 1 > capacity)
+        {
+            return {last, std::errc::value_too_large};
         }
+
+        std::memmove(first + exponent + 2, first + exponent + 1, static_cast<std::size_t>(num_dig - exponent - 1));
+        first[exponent + 1] = '.';
+        return {first + num_dig + 1, std::errc()};
     }
 
-    // Make sure the result will fit in the buffer
-    const std::ptrdiff_t total_length = total_buffer_length(num_dig, value_struct.exponent, (value < 0));
-    if (total_length > buffer_size)
+    const int leading_zeros = -exponent - 1;
+    const int total_length = 2 + leading_zeros + num_dig;
+    if (total_length > capacity)
     {
         return {last, std::errc::value_too_large};
     }
 
-    // Insert leading 0s if needed before printing the significand 
-    if (abs_value < 1)
+    std::memmove(first + 2 + leading_zeros, first, static_cast<std::size_t>(num_dig));
+    std::memcpy(first, "0.", 2U); // NOLINT : No null terminator is purposeful
+    std::memset(first + 2, '0', static_cast<std::size_t>(leading_zeros));
+    return {first + total_length, std::errc()};
+}
+
+// Writes the n lowest decimal digits of value so that they end at last, and returns the digits above them
+inline std::uint64_t write_fixed_digits(char* last, std::uint64_t value, int n) noexcept
+{
+    for (; n >= 2; n -= 2)
+    {
+        last -= 2;
+        std::memcpy(last, radix_table + static_cast<std::size_t>(value % 100) * 2, 2U);
+        value /= 100;
+    }
+
+    if (n == 1)
+    {
+        *--last = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+
+    return value;
+}
+
+// Shortest fixed output of (-1)^is_negative * significand * 10^exponent in a single pass: the digits are written right
+// to left into their final position, and the decimal point goes between them, so nothing has to be moved afterwards
+inline to_chars_result to_chars_fixed_decimal(char* first, char* last, std::uint64_t significand, int exponent, bool is_negative) noexcept
+{
+    // Every write below is checked against the space that is left, so a buffer of exactly the output length is enough
+    if (first >= last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    if (significand == 0)
     {
-        // Additional bounds check for inserted zeros
-        if (-value_struct.exponent - starting_num_digits + 2 > (last - first))
+        if (last - first < 1)
         {
             return {last, std::errc::value_too_large};
         }
 
-        std::memcpy(first, "0.", 2U);
-        std::memset(first + 2, '0', -value_struct.exponent - starting_num_digits);
-        first += 2 - value_struct.exponent - starting_num_digits;
+        *first++ = '0';
+        return {first, std::errc()};
     }
 
-    auto r = to_chars_integer_impl(first, last, value_struct.significand);
-    if (r.ec != std::errc())
+    const int num_dig = num_digits(significand);
+    const auto available = last - first;
+
+    if (exponent >= 0)
     {
-        return r;
+        // Integer with zeros appended
+        if (num_dig + exponent > available)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        write_fixed_digits(first + num_dig, significand, num_dig);
+        std::memset(first + num_dig, '0', static_cast<std::size_t>(exponent));
+        return {first + num_dig + exponent, std::errc()};
     }
 
-    // Bounds check
-    if (abs_value >= 1)
+    const int fraction_digits = -exponent;
+    if (fraction_digits < num_dig)
     {
-        if (value_struct.exponent < 0 && -value_struct.exponent < buffer_size)
+        // The decimal point goes between the digits
+        const int integer_digits = num_dig - fraction_digits;
+        if (num_dig + 1 > available)
         {
-            std::memmove(r.ptr + value_struct.exponent + 1, r.ptr + value_struct.exponent,
-                         static_cast<std::size_t>(-value_struct.exponent));
-            std::memset(r.ptr + value_struct.exponent, '.', 1);
-            ++r.ptr;
+            return {last, std::errc::value_too_large};
         }
 
-        // Add additional zeros as needed
-        if (value_struct.exponent > 0)
-        {
-            const auto zeros_to_append = static_cast<std::size_t>(value_struct.exponent);
+        const auto integer_part = write_fixed_digits(first + num_dig + 1, significand, fraction_digits);
+        first[integer_digits] = '.';
+        write_fixed_digits(first + integer_digits, integer_part, integer_digits);
+        return {first + num_dig + 1, std::errc()};
+    }
 
-            if (zeros_to_append > static_cast<std::size_t>(last - r.ptr))
-            {
-                return {last, std::errc::value_too_large};
-            }
+    // 0.000ddd
+    if (2 + fraction_digits > available)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, "0.", 2U); // NOLINT : No null terminator is purposeful
+    std::memset(first + 2, '0', static_cast<std::size_t>(fraction_digits - num_dig));
+    write_fixed_digits(first + 2 + fraction_digits, significand, num_dig);
+    return {first + 2 + fraction_digits, std::errc()};
+}
+
+template <typename Real>
+to_chars_result to_chars_fixed_impl(char* first, char* last, Real value) noexcept
+{
+    const auto value_struct = boost::charconv::detail::to_decimal(value);
+    return to_chars_fixed_decimal(first, last, value_struct.significand, value_struct.exponent, value_struct.is_negative);
+}
+
+// Fixed formatting with at most 9 digits after the decimal point of a double below 1e15 (or a float widened to one).
+// The fractional bits times 10^precision are below 2^83, so they are scaled exactly in 128 bits,
+// and the bits shifted out decide the rounding to nearest with ties to even, like printf does.
+BOOST_CHARCONV_SAFEBUFFERS inline to_chars_result to_chars_fixed_small_precision(char* first, char* last, double value, int precision) noexcept
+{
+    BOOST_CHARCONV_ASSERT(precision >= 0 && precision <= 9);
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(value));
+
+    if ((bits >> 63) != 0)
+    {
+        *first++ = '-';
+    }
+
+    const auto biased_exponent = static_cast<int>((bits >> 52) & UINT64_C(0x7FF));
+    std::uint64_t significand = bits & UINT64_C(0x000FFFFFFFFFFFFF);
+    int shift = 1074;
+    if (biased_exponent != 0)
+    {
+        significand |= UINT64_C(1) << 52;
+        shift = 1075 - biased_exponent;
+    }
 
-            std::memset(r.ptr, '0', zeros_to_append);
-            r.ptr += zeros_to_append;
+    // Values below 1e15 < 2^50 always have fractional bits
+    BOOST_CHARCONV_ASSERT(shift > 2);
+
+    std::uint64_t integer_part = 0;
+    std::uint64_t fraction = significand;
+    if (shift < 64)
+    {
+        integer_part = significand >> shift;
+        fraction = significand & ((UINT64_C(1) << shift) - 1);
+    }
+
+    const std::uint64_t scale = powers_of_10[static_cast<std::size_t>(precision)];
+    const uint128 scaled = umul128(fraction, scale);
+
+    // digits = scaled >> shift, rounded with the bit below it and whether anything under that is set
+    std::uint64_t digits = 0;
+    bool round_bit = false;
+    bool sticky = false;
+    if (shift < 64)
+    {
+        digits = (scaled.high << (64 - shift)) | (scaled.low >> shift);
+        round_bit = ((scaled.low >> (shift - 1)) & 1) != 0;
+        sticky = (scaled.low & ((UINT64_C(1) << (shift - 1)) - 1)) != 0;
+    }
+    else if (shift == 64)
+    {
+        digits = scaled.high;
+        round_bit = (scaled.low >> 63) != 0;
+        sticky = (scaled.low & ((UINT64_C(1) << 63) - 1)) != 0;
+    }
+    else if (shift < 128)
+    {
+        digits = scaled.high >> (shift - 64);
+        round_bit = ((scaled.high >> (shift - 65)) & 1) != 0;
+        sticky = scaled.low != 0 || (scaled.high & ((UINT64_C(1) << (shift - 65)) - 1)) != 0;
+    }
+
+    // With no digits after the decimal point the last printed digit belongs to the integer part
+    const std::uint64_t last_digit = precision == 0 ? integer_part : digits;
+    if (round_bit && (sticky || (last_digit & 1) != 0))
+    {
+        if (++digits == scale)
+        {
+            digits = 0;
+            ++integer_part;
         }
     }
 
-    return { r.ptr, std::errc() };
+    const auto r = to_chars_integer_impl(first, last, integer_part);
+    if (r.ec != std::errc() || precision == 0)
+    {
+        return r;
+    }
+
+    if (last - r.ptr < precision + 1)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    *r.ptr = '.';
+    for (int i = precision; i > 0; --i)
+    {
+        r.ptr[i] = static_cast<char>('0' + digits % 10);
+        digits /= 10;
+    }
+
+    return {r.ptr + precision + 1, std::errc()};
+}
+
+// General output with a precision into a buffer that may be too small for it. floff writes into a temporary buffer
+// of the longest output, which is in a function of its own so that it is only on the stack when this path is taken.
+template <int max_output_length, typename Real>
+BOOST_NOINLINE to_chars_result to_chars_general_precision_small_buffer(char* first, char* last, Real value, int precision) noexcept
+{
+    char temp_buffer[max_output_length];
+    auto result = boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                 boost::charconv::detail::floff_extended_cache>(value, precision,
+                                                                                               temp_buffer,
+                                                                                               temp_buffer + max_output_length,
+                                                                                               chars_format::general);
+    auto output_size = static_cast<std::size_t>(result.ptr - temp_buffer);
+    if (static_cast<std::size_t>(last - first) < output_size)
+    {
+        return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, temp_buffer, output_size);
+    return {first + output_size, std::errc()};
 }
 
 template <typename Real>
 to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_format fmt, int precision) noexcept
 {
+    fmt = output_format(fmt);
+
     using Unsigned_Integer = typename std::conditional<std::is_same<Real, double>::value, std::uint64_t, std::uint32_t>::type;
 
     // Sanity check our bounds
@@ -690,7 +1050,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         {
             if (abs_value > min_fractional_value && abs_value < max_fractional_value)
             {
-                return to_chars_fixed_impl(first, last, value, fmt, precision);
+                return to_chars_fixed_impl(first, last, value);
             }
             else if (abs_value >= max_fractional_value && abs_value < max_value)
             {
@@ -711,39 +1071,48 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         }
         else if (fmt == boost::charconv::chars_format::fixed)
         {
-            return to_chars_fixed_impl(first, last, value, fmt, precision);
+            return to_chars_fixed_impl(first, last, value);
         }
     }
     else
     {
         if (fmt != boost::charconv::chars_format::hex)
         {
+            // The common case of prices, measurements, etc. does not need the general machinery of floff
+            if (fmt == boost::charconv::chars_format::fixed && precision <= 9 && abs_value < static_cast<Real>(1e15))
+            {
+                return to_chars_fixed_small_precision(first, last, static_cast<double>(value), precision);
+            }
+
+            // floff can not split the digits of double subnormals correctly
+            if (abs_value < (std::numeric_limits<Real>::min)() && abs_value != 0 && std::is_same<Real, double>::value)
+            {
+                return to_chars_exact_impl(first, last, value, fmt, precision);
+            }
+
             if (fmt == boost::charconv::chars_format::general)
             {
-                constexpr int max_output_length = std::is_same<Real, double>::value ? 773 : 117;
                 constexpr int max_precision = std::is_same<Real, double>::value ? 767 : 112;
                 // We remove trailing zeros, so precision > max_precision is same as precision == max_precision.
                 if (precision > max_precision)
                 {
                     precision = max_precision;
                 }
-                char temp_buffer[max_output_length];
-                auto result = boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                             boost::charconv::detail::extended_cache_long>(value, precision,
-                                                                                                           temp_buffer,
-                                                                                                           temp_buffer + max_output_length,
-                                                                                                           fmt);
-                auto output_size = static_cast<std::size_t>(result.ptr - temp_buffer);
-                if (static_cast<std::size_t>(last - first) < output_size)
+
+                // The output is at most a sign, precision digits, the decimal dot, and either the leading "0.000"
+                // or an exponent like e+308, so floff can write straight into a buffer that holds precision + 8.
+                // Only smaller buffers need the temporary one to report value_too_large without overflowing.
+                if (last - first >= static_cast<std::ptrdiff_t>(precision) + 8)
                 {
-                    return {last, std::errc::value_too_large};
+                    return boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                          boost::charconv::detail::floff_extended_cache>(value, precision,
+                                                                                                        first, last, fmt);
                 }
-                std::memcpy(first, temp_buffer, output_size);
-                return {first + output_size, std::errc()};
-                
+
+                return to_chars_general_precision_small_buffer<max_precision + 8>(first, last, value, precision);
             }
-            return boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                  boost::charconv::detail::extended_cache_long>(value, precision,
+            return boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                  boost::charconv::detail::floff_extended_cache>(value, precision,
                                                                                                 first, last, fmt);
         }
     }
@@ -756,6 +1125,10 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
             // The dragonbox impl will return the correct type of NaN
             return boost::charconv::detail::dragonbox_to_chars(value, first, last, chars_format::general);
         case FP_ZERO:
+            if (last - first < 4 + static_cast<std::ptrdiff_t>(std::signbit(value)))
+            {
+                return {last, std::errc::value_too_large};
+            }
             if (std::signbit(value))
             {
                 *first++ = '-';
@@ -776,6 +1149,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
 template <>
 to_chars_result to_chars_float_impl(char* first, char* last, long double value, chars_format fmt, int precision) noexcept
 {
+    fmt = output_format(fmt);
+
     static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
 
     const auto classification = std::fpclassify(value);
@@ -809,37 +1184,26 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
         return {last, std::errc::value_too_large};
     }
 
-    if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
-    {
-        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
-        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
-
-        if (num_chars > 0)
-        {
-            return { first + num_chars, std::errc() };
-        }
-    }
-    else if (fmt == boost::charconv::chars_format::hex)
+    if (fmt == boost::charconv::chars_format::hex)
     {
         return boost::charconv::detail::to_chars_hex(first, last, value, precision);
     }
-    else if (fmt == boost::charconv::chars_format::fixed)
+    else if (precision != -1)
     {
-        const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
-        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
+        return boost::charconv::detail::to_chars_exact_impl(first, last, value, fmt, precision);
+    }
 
-        if (num_chars > 0)
-        {
-            return { first + num_chars, std::errc() };
-        }
-        else if (num_chars == -static_cast<int>(std::errc::value_too_large))
-        {
-            return { last, std::errc::value_too_large };
-        }
+    const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
+    const auto num_chars = fmt == boost::charconv::chars_format::fixed ?
+                           boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision) :
+                           boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
+
+    if (num_chars > 0)
+    {
+        return { first + num_chars, std::errc() };
     }
 
-    // Fallback to printf methods
-    return boost::charconv::detail::to_chars_printf_impl(first, last, value, fmt, precision);
+    return {last, std::errc::value_too_large};
 }
 
 #endif
@@ -849,21 +1213,27 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
 template <>
 to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, chars_format fmt, int precision) noexcept
 {
+    fmt = output_format(fmt);
+
     // Sanity check our bounds
     if (first >= last)
     {
         return {last, std::errc::value_too_large};
     }
 
-    char* const original_first = first;
-
-    if (isnanq(value))
+    // Classify from the bits, since isnanq and isinfq live in libquadmath
+    words128 bits;
+    std::memcpy(&bits, &value, sizeof(value));
+    if ((bits.hi & UINT64_C(0x7FFF000000000000)) == UINT64_C(0x7FFF000000000000))
     {
-        return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_NAN);
+        const bool is_nan = (bits.hi & UINT64_C(0x0000FFFFFFFFFFFF)) != 0 || bits.lo != 0;
+        return boost::charconv::detail::to_chars_nonfinite(first, last, value, is_nan ? FP_NAN : FP_INFINITE);
     }
-    else if (isinfq(value))
+
+    // The exact path checks the size of its output itself, so it may fill the buffer completely
+    if (precision != -1 && fmt != boost::charconv::chars_format::hex)
     {
-        return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_INFINITE);
+        return boost::charconv::detail::to_chars_exact_impl(first, last, value, fmt, precision);
     }
 
     // Sanity check our bounds
@@ -874,42 +1244,22 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
         return {last, std::errc::value_too_large};
     }
 
-    if ((fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific))
-    {
-        const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
-        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
-
-        if (num_chars > 0)
-        {
-            return { first + num_chars, std::errc() };
-        }
-        else if (num_chars == -1)
-        {
-            return {last, std::errc::value_too_large};
-        }
-    }
-    else if (fmt == boost::charconv::chars_format::hex)
+    if (fmt == boost::charconv::chars_format::hex)
     {
         return boost::charconv::detail::to_chars_hex(first, last, value, precision);
     }
-    else if (fmt == boost::charconv::chars_format::fixed)
-    {
-        const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
-        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
 
-        if (num_chars > 0)
-        {
-            return { first + num_chars, std::errc() };
-        }
-        else if (num_chars == -static_cast<int>(std::errc::value_too_large))
-        {
-            return { last, std::errc::value_too_large };
-        }
+    const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
+    const auto num_chars = fmt == boost::charconv::chars_format::fixed ?
+                           boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision) :
+                           boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
+
+    if (num_chars > 0)
+    {
+        return { first + num_chars, std::errc() };
     }
 
-    first = original_first;
-    // Fallback to printf
-    return boost::charconv::detail::to_chars_printf_impl(first, last, value, fmt, precision);
+    return {last, std::errc::value_too_large};
 }
 
 #endif
@@ -919,6 +1269,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
 template <typename T>
 to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, chars_format fmt, int precision) noexcept
 {
+    fmt = output_format(fmt);
+
     const auto classification = std::fpclassify(value);
 
     if (classification == FP_NAN || classification == FP_INFINITE)
@@ -926,6 +1278,20 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
         return boost::charconv::detail::to_chars_nonfinite(first, last, value, classification);
     }
 
+    if (precision == -1 && fmt != boost::charconv::chars_format::hex)
+    {
+        using type_layout =
+            #ifdef BOOST_CHARCONV_HAS_FLOAT16
+            typename std::conditional<std::is_same<T, std::float16_t>::value, ieee754_binary16, brainfloat16>::type;
+            #else
+            brainfloat16;
+            #endif
+
+        std::uint16_t bits;
+        std::memcpy(&bits, &value, sizeof(value));
+        return boost::charconv::detail::to_chars_16_bit_shortest(first, last, to_decimal_16_bit<type_layout>(bits), fmt);
+    }
+
     // Sanity check our bounds
     const std::ptrdiff_t buffer_size = last - first;
     auto real_precision = boost::charconv::detail::get_real_precision<T>(precision);
@@ -0,0 +1,253 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The C functions must behave as strtod, strtoll, and snprintf in the "C" locale
+
+#include <boost/charconv/c_api.h>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <string>
+#include <climits>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+
+void test_strtod_string(const char* str, bool check_errno = true)
+{
+    char* end = nullptr;
+    char* expected_end = nullptr;
+
+    errno = 0;
+    const double expected = std::strtod(str, &expected_end);
+    const int expected_errno = errno;
+
+    errno = 0;
+    const double value = bc_strtod(str, &end);
+    const int value_errno = errno;
+
+    BOOST_TEST(end == expected_end);
+    if (check_errno)
+    {
+        BOOST_TEST_EQ(value_errno, expected_errno);
+    }
+    if (!BOOST_TEST(std::memcmp(&value, &expected, sizeof(double)) == 0 || (std::isnan(value) && std::isnan(expected))))
+    {
+        std::cerr << "String: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_strtod()
+{
+    const char* strings[] = {"", " ", "-", "+", "1", "+1", "-1", " \t\n\v\f\r1.5", "+-1", "-+1", "--1", "1e", "1e+", "1.", ".5", ".",
+                             "-.5e-3x", "1,5", "1e400", "-1e400", "1e-400", "-1e-400", "inf", "-INFINITY", "+Infinit", "nan",
+                             "-nan(123)", "NaN(", "0x", "0x.", "0xg", "-0x", "0x1", "0X1P3", "0x1.8p1", "-0x.8p-1", "0x1p",
+                             "0x1p+", "0xABCDEFp-20", "0x1.fffffffffffff8p0", "0x1.fffffffffffff7ffffp0", "0x1.00000000000008p0",
+                             "0x1.000000000000080000001p0", "0x1.00000000000018p0", "0x1p1023", "0x1p1024", "0x1.fffffffffffffp1023",
+                             "0x1.fffffffffffff8p1023", "0x1p-1022", "0x1p-1074", "0x1p-1075", "0x1.0000001p-1075", "0x3p-1076",
+                             "0x1p-99999999999", "0x1p99999999999", "0x0.0000000000000000000001p0", "0x0000000000000000000001",
+                             "0x123456789abcdef0123456789p-100", "0x0p0", "-0x0", "0x1.p1", "1.5 2.5", "123456789012345678901234567890"};
+    for (const char* str : strings)
+    {
+        test_strtod_string(str);
+    }
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = dist(gen);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        char buffer[128];
+        if (i % 2 == 0)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*g", i % 25, value);
+        }
+        else
+        {
+            std::snprintf(buffer, sizeof(buffer), "%a", value);
+        }
+
+        test_strtod_string(buffer);
+    }
+
+    // Subnormal values only set ERANGE when they are inexact
+    const char* subnormals[] = {"1E-0311", "4.9406564584124654e-324", "2.2250738585072009e-308", "-3e-320", "0.0000e-400",
+                                "2.4703282292062327e-324", "1e-330"};
+    for (const char* str : subnormals)
+    {
+        test_strtod_string(str);
+    }
+
+    const double exact_subnormals[] = {4.9406564584124654e-324, 2.2250738585072009e-308, -1.1125369292536007e-308};
+    for (const double value : exact_subnormals)
+    {
+        char buffer[1536];
+        std::snprintf(buffer, sizeof(buffer), "%.766e", value);
+        test_strtod_string(buffer);
+
+        // One more digit makes it inexact
+        char* const exponent = std::strchr(buffer, 'e');
+        std::memmove(exponent + 1, exponent, std::strlen(exponent) + 1);
+        *exponent = '1';
+        test_strtod_string(buffer);
+
+        // Trailing zeros and a fixed format keep it exact
+        std::snprintf(buffer, sizeof(buffer), "%.1100f", value);
+        test_strtod_string(buffer);
+    }
+
+    // A null endptr
+    BOOST_TEST_EQ(bc_strtod("2.5", nullptr), 2.5);
+}
+
+void test_strtoll_string(const char* str, int base)
+{
+    char* end = nullptr;
+    char* expected_end = nullptr;
+
+    errno = 0;
+    const long long expected = std::strtoll(str, &expected_end, base);
+    const int expected_errno = errno;
+
+    errno = 0;
+    const long long value = bc_strtoll(str, &end, base);
+    const int value_errno = errno;
+
+    BOOST_TEST(end == expected_end);
+    BOOST_TEST_EQ(value_errno, expected_errno);
+    if (!BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "String: " << str << ", base: " << base << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_strtoll()
+{
+    const char* strings[] = {"", " ", "-", "+", "0", "-0", "+12", " \t-12", "+-1", "--1", "12abc", "0x", "0x1f", "0X1F", "-0x80",
+                             "0xg", "0x-1", "010", "08", "0b1", "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+                             "-9223372036854775809", "99999999999999999999999", "-99999999999999999999999", "zz", "Z", "1 2"};
+    for (const char* str : strings)
+    {
+        for (const int base : {0, 2, 8, 10, 16, 36})
+        {
+            test_strtoll_string(str, base);
+        }
+    }
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> dist((std::numeric_limits<long long>::min)(), (std::numeric_limits<long long>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const long long value = dist(gen);
+        const int base = 2 + i % 35;
+
+        char buffer[128];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer) - 1, value, base);
+        std::string str(buffer, r.ptr);
+        str.resize(gen() % (str.size() + 1));
+
+        test_strtoll_string(str.c_str(), base);
+    }
+
+    // Invalid bases
+    for (const int base : {-1, 1, 37})
+    {
+        const char* str = "123";
+        char* end = nullptr;
+        errno = 0;
+        BOOST_TEST_EQ(bc_strtoll(str, &end, base), 0);
+        BOOST_TEST_EQ(errno, EINVAL);
+        BOOST_TEST(end == str);
+    }
+}
+
+void test_dtoa_value(double value)
+{
+    char buffer[64];
+    char expected[64];
+
+    // The shortest representation reads back to the same value
+    const int length = bc_dtoa_shortest(buffer, sizeof(buffer), value);
+    BOOST_TEST_EQ(length, static_cast<int>(std::strlen(buffer)));
+    const double parsed = std::strtod(buffer, nullptr);
+    BOOST_TEST(std::memcmp(&parsed, &value, sizeof(double)) == 0 || (std::isnan(parsed) && std::isnan(value)));
+
+    for (const int precision : {-1, 0, 1, 6, 15, 17, 25})
+    {
+        const int expected_length = std::snprintf(expected, sizeof(expected), "%.*g", precision, value);
+        const int precision_length = bc_dtoa_precision(buffer, sizeof(buffer), value, precision);
+        BOOST_TEST_EQ(precision_length, expected_length);
+        if (!BOOST_TEST_CSTR_EQ(buffer, expected))
+        {
+            std::cerr << "Precision: " << precision << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void test_dtoa()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = dist(gen);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_dtoa_value(value);
+    }
+
+    const double values[] = {0.0, -0.0, 1.0, 0.1, 1e-5, 123456.0, 1234567.0, 1e300, 5e-324, HUGE_VAL, -HUGE_VAL,
+                             std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::quiet_NaN(),
+                             std::numeric_limits<double>::signaling_NaN()};
+    for (const double value : values)
+    {
+        test_dtoa_value(value);
+    }
+
+    // Truncated output as with snprintf
+    char buffer[8];
+    std::memset(buffer, 'x', sizeof(buffer));
+    BOOST_TEST_EQ(bc_dtoa_precision(buffer, 5, 0.1, 17), 19);
+    BOOST_TEST_CSTR_EQ(buffer, "0.10");
+    BOOST_TEST_EQ(buffer[5], 'x');
+
+    BOOST_TEST_EQ(bc_dtoa_shortest(buffer, 3, -1.5), 4);
+    BOOST_TEST_CSTR_EQ(buffer, "-1");
+
+    BOOST_TEST_EQ(bc_dtoa_shortest(nullptr, 0, 1e300), 6);
+
+    // Precisions past the stack buffer
+    std::string large(2000, '\0');
+    char expected[2000];
+    for (const int precision : {1000, 1100})
+    {
+        const int length = bc_dtoa_precision(&large[0], large.size(), 1e-300, precision);
+        BOOST_TEST_EQ(length, std::snprintf(expected, sizeof(expected), "%.*g", precision, 1e-300));
+        BOOST_TEST_CSTR_EQ(large.c_str(), expected);
+
+        const int short_length = bc_dtoa_precision(&large[0], 10, 1e-300, precision);
+        BOOST_TEST_EQ(short_length, length);
+        BOOST_TEST_EQ(std::string(large.c_str()), std::string(expected, 9));
+    }
+}
+
+int main()
+{
+    test_strtod();
+    test_strtoll();
+    test_dtoa();
+
+    return boost::report_errors();
+}
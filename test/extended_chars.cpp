@@ -0,0 +1,305 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The wchar_t, char8_t, char16_t and char32_t overloads must give the same results as the char ones
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename UC>
+std::basic_string<UC> widen(const std::string& str)
+{
+    std::basic_string<UC> result;
+    for (const char c : str)
+    {
+        result += static_cast<UC>(c);
+    }
+    return result;
+}
+
+template <typename UC, typename T>
+void test_integer(T value, int base)
+{
+    char buffer[256];
+    UC wide_buffer[256];
+
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+    BOOST_TEST(r);
+    const std::string expected(buffer, r.ptr);
+    const auto length = static_cast<std::ptrdiff_t>(expected.size());
+
+    const auto r_wide = boost::charconv::to_chars(wide_buffer, wide_buffer + 256, value, base);
+    BOOST_TEST(r_wide);
+    BOOST_TEST(r_wide.ptr == wide_buffer + length);
+    BOOST_TEST(std::basic_string<UC>(wide_buffer, r_wide.ptr) == widen<UC>(expected));
+
+    // Must fit exactly, and fail with one character less
+    BOOST_TEST(boost::charconv::to_chars(wide_buffer, wide_buffer + length, value, base).ptr == wide_buffer + length);
+    const auto r_short = boost::charconv::to_chars(wide_buffer, wide_buffer + length - 1, value, base);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+    BOOST_TEST(r_short.ptr == wide_buffer + length - 1);
+
+    T parsed {};
+    const auto r_parse = boost::charconv::from_chars(wide_buffer, r_wide.ptr, parsed, base);
+    BOOST_TEST(r_parse);
+    BOOST_TEST(r_parse.ptr == r_wide.ptr);
+    BOOST_TEST(parsed == value);
+}
+
+template <typename UC, typename T>
+void test_integers()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        test_integer<UC>(dist(gen), 2 + i % 35);
+    }
+
+    test_integer<UC>(T(0), 10);
+    test_integer<UC>((std::numeric_limits<T>::min)(), 2);
+    test_integer<UC>((std::numeric_limits<T>::max)(), 2);
+}
+
+template <typename UC, typename T>
+void test_float(T value, boost::charconv::chars_format fmt, int precision)
+{
+    std::vector<char> buffer(8192);
+    std::vector<UC> wide_buffer(8192);
+    char* const first = buffer.data();
+    UC* const wide_first = wide_buffer.data();
+
+    const auto r = precision < 0 ? boost::charconv::to_chars(first, first + buffer.size(), value, fmt) :
+                                   boost::charconv::to_chars(first, first + buffer.size(), value, fmt, precision);
+    BOOST_TEST(r);
+    const std::string expected(first, r.ptr);
+    const auto length = static_cast<std::ptrdiff_t>(expected.size());
+
+    const auto r_wide = precision < 0 ? boost::charconv::to_chars(wide_first, wide_first + wide_buffer.size(), value, fmt) :
+                                        boost::charconv::to_chars(wide_first, wide_first + wide_buffer.size(), value, fmt, precision);
+    BOOST_TEST(r_wide);
+    if (!BOOST_TEST(std::basic_string<UC>(wide_first, r_wide.ptr) == widen<UC>(expected)))
+    {
+        std::cerr << "Expected: " << expected << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T parsed {};
+    T expected_parsed {};
+    const auto r_parse_narrow = boost::charconv::from_chars(first, r.ptr, expected_parsed, fmt);
+    const auto r_parse = boost::charconv::from_chars(wide_first, wide_first + length, parsed, fmt);
+    BOOST_TEST(r_parse.ec == r_parse_narrow.ec);
+    BOOST_TEST(r_parse.ptr - wide_first == r_parse_narrow.ptr - first);
+    // Not memcmp, which would also compare the padding of long double
+    BOOST_TEST((parsed == expected_parsed && std::signbit(parsed) == std::signbit(expected_parsed)) ||
+               (std::isnan(parsed) && std::isnan(expected_parsed)));
+
+    // Last, since char8_t output goes straight to the buffer and may leave part of it there
+    const auto r_short = precision < 0 ? boost::charconv::to_chars(wide_first, wide_first + length - 1, value, fmt) :
+                                         boost::charconv::to_chars(wide_first, wide_first + length - 1, value, fmt, precision);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+}
+
+template <typename UC, typename T, typename Unsigned>
+void test_floats()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<Unsigned> dist(0, (std::numeric_limits<Unsigned>::max)());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const Unsigned bits = dist(gen);
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        test_float<UC>(value, formats[i % 4], -1);
+        test_float<UC>(value, formats[i % 4], i % 20);
+    }
+
+    // Outputs longer than the stack buffer of the implementation
+    test_float<UC>(static_cast<T>(1e30), boost::charconv::chars_format::fixed, 1500);
+    test_float<UC>((std::numeric_limits<T>::max)(), boost::charconv::chars_format::scientific, 1200);
+    test_float<UC>((std::numeric_limits<T>::max)(), boost::charconv::chars_format::fixed, 1200);
+    test_float<UC>((std::numeric_limits<T>::denorm_min)(), boost::charconv::chars_format::fixed, -1);
+}
+
+template <typename UC>
+void test_parse()
+{
+    double value = 42.0;
+
+    const auto inf = widen<UC>("-infinity");
+    auto r = boost::charconv::from_chars(inf.data(), inf.data() + inf.size(), value);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == inf.data() + inf.size());
+    BOOST_TEST(std::isinf(value) && value < 0);
+
+    const auto nan = widen<UC>("nan(snan)");
+    r = boost::charconv::from_chars(nan.data(), nan.data() + nan.size(), value);
+    BOOST_TEST(r);
+    BOOST_TEST(std::isnan(value));
+
+    const std::string narrow_hex = "1.8p+1";
+    const auto hex = widen<UC>(narrow_hex);
+    double expected = 0;
+    boost::charconv::from_chars(narrow_hex.data(), narrow_hex.data() + narrow_hex.size(), expected, boost::charconv::chars_format::hex);
+    r = boost::charconv::from_chars(hex.data(), hex.data() + hex.size(), value, boost::charconv::chars_format::hex);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == hex.data() + hex.size());
+    BOOST_TEST_EQ(value, expected);
+
+    const auto out_of_range = widen<UC>("1e999");
+    r = boost::charconv::from_chars(out_of_range.data(), out_of_range.data() + out_of_range.size(), value);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    value = 42.0;
+    const auto invalid = widen<UC>("x1");
+    r = boost::charconv::from_chars(invalid.data(), invalid.data() + invalid.size(), value);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == invalid.data());
+    BOOST_TEST_EQ(value, 42.0);
+
+    long double long_value = 0;
+    const auto long_str = widen<UC>("-1.25e-2");
+    const auto r_long = boost::charconv::from_chars(long_str.data(), long_str.data() + long_str.size(), long_value);
+    BOOST_TEST(r_long);
+    BOOST_TEST_EQ(long_value, -1.25e-2L);
+
+    BOOST_IF_CONSTEXPR (sizeof(UC) == 1)
+    {
+        return;
+    }
+
+    // Characters whose low byte is a digit must end the number, U+0131 and U+0335 in the example below
+    std::basic_string<UC> str = widen<UC>("12.5");
+    str += static_cast<UC>(0x0131U);
+    str += static_cast<UC>(0x0335U);
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::hex})
+    {
+        r = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, fmt);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == str.data() + 4);
+    }
+
+    int int_value = 0;
+    const auto r_int = boost::charconv::from_chars(str.data(), str.data() + str.size(), int_value);
+    BOOST_TEST(r_int);
+    BOOST_TEST(r_int.ptr == str.data() + 2);
+    BOOST_TEST_EQ(int_value, 12);
+
+    str = widen<UC>("7");
+    str += static_cast<UC>(0x0137U);
+    const auto r_int_base = boost::charconv::from_chars(str.data(), str.data() + str.size(), int_value, 16);
+    BOOST_TEST(r_int_base);
+    BOOST_TEST(r_int_base.ptr == str.data() + 1);
+    BOOST_TEST_EQ(int_value, 7);
+}
+
+// Texts that do not start with a character of a number, for every type and format, including those that are
+// copied to char before they are parsed
+template <typename UC, typename T>
+void test_not_a_number(const std::basic_string<UC>& text, const std::string& narrow)
+{
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                           boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex})
+    {
+        T expected = 42;
+        const auto expected_r = boost::charconv::from_chars(narrow.data(), narrow.data() + narrow.size(), expected, fmt);
+
+        T value = 42;
+        const auto r = boost::charconv::from_chars(text.data(), text.data() + text.size(), value, fmt);
+
+        BOOST_TEST(expected_r.ec == std::errc::invalid_argument);
+        if (!BOOST_TEST(r.ec == expected_r.ec) || !BOOST_TEST(r.ptr - text.data() == expected_r.ptr - narrow.data()))
+        {
+            std::cerr << "Text: \"" << narrow << "\" Format: " << static_cast<unsigned>(fmt) << std::endl; // LCOV_EXCL_LINE
+        }
+        BOOST_TEST(value == expected);
+    }
+}
+
+template <typename UC>
+void test_not_a_number()
+{
+    const char* const texts[] = {" x", " 1", "\t1", ",1", "[1]", "*", "#nan", " 1p3", "\"1\""};
+
+    for (const char* text : texts)
+    {
+        test_not_a_number<UC, float>(widen<UC>(text), text);
+        test_not_a_number<UC, double>(widen<UC>(text), text);
+        test_not_a_number<UC, long double>(widen<UC>(text), text);
+    }
+
+    BOOST_IF_CONSTEXPR (sizeof(UC) == 1)
+    {
+        return;
+    }
+
+    // An empty range, which the char overloads (and so char8_t) of long double and hex take for zero
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::hex})
+    {
+        const std::basic_string<UC> empty;
+        long double value = 42;
+        const auto r = boost::charconv::from_chars(empty.data(), empty.data(), value, fmt);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+        BOOST_TEST(r.ptr == empty.data());
+        BOOST_TEST(value == 42);
+    }
+
+    // A character outside of ASCII, which is not copied to char, and one whose low byte is a digit
+    for (const unsigned c : {0x00B5U, 0x0131U})
+    {
+        std::basic_string<UC> text(1, static_cast<UC>(c));
+        text += widen<UC>("1.5");
+        test_not_a_number<UC, double>(text, "?1.5");
+        test_not_a_number<UC, long double>(text, "?1.5");
+    }
+}
+
+template <typename UC>
+void test_char_type()
+{
+    test_integers<UC, int>();
+    test_integers<UC, unsigned>();
+    test_integers<UC, long long>();
+    test_integers<UC, unsigned long long>();
+    test_integers<UC, short>();
+
+    test_floats<UC, float, std::uint32_t>();
+    test_floats<UC, double, std::uint64_t>();
+
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    // Fixed output of long double can be longer than the stack buffer without a precision
+    test_float<UC>((std::numeric_limits<long double>::denorm_min)(), boost::charconv::chars_format::fixed, -1);
+    #endif
+
+    test_parse<UC>();
+    test_not_a_number<UC>();
+}
+
+int main()
+{
+    test_char_type<wchar_t>();
+    test_char_type<char16_t>();
+    test_char_type<char32_t>();
+
+    #ifdef BOOST_CHARCONV_HAS_CHAR8_T
+    test_char_type<char8_t>();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,192 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_fast_approx must give the value of from_chars, or the one next to it toward zero when there are more
+// than 19 significant digits, and the same results otherwise
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename T>
+bool same_value(T a, T b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0 || (std::isnan(a) && std::isnan(b));
+}
+
+template <typename T>
+void check(const std::string& text, bool exact)
+{
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+
+    T expected_value = T(42);
+    const auto expected = boost::charconv::from_chars(first, last, expected_value);
+
+    T value = T(42);
+    const auto r = boost::charconv::from_chars_fast_approx(first, last, value);
+
+    // At the ends of the range the value next to the correct one toward zero is the largest finite value where the
+    // correct one overflows, or zero (which is out of range) where the correct one is the smallest subnormal
+    if (!exact && r.ec != expected.ec)
+    {
+        BOOST_TEST(r.ptr == expected.ptr);
+        if (!BOOST_TEST((r && expected.ec == std::errc::result_out_of_range && std::fabs(value) == (std::numeric_limits<T>::max)()) ||
+                        (expected && r.ec == std::errc::result_out_of_range && std::fabs(expected_value) == std::numeric_limits<T>::denorm_min())))
+        {
+            std::cerr << "Text: " << text << std::endl; // LCOV_EXCL_LINE
+        }
+        return;
+    }
+
+    if (!BOOST_TEST(r == expected))
+    {
+        std::cerr << "Text: " << text << std::endl; // LCOV_EXCL_LINE
+    }
+
+    if (exact || !expected)
+    {
+        BOOST_TEST(same_value(value, expected_value));
+    }
+    else if (!BOOST_TEST(same_value(value, expected_value) || same_value(value, std::nextafter(expected_value, T(0)))))
+    {
+        std::cerr << "Text: " << text << "\nValue: " << value << "\nExpected: " << expected_value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_shortest()
+{
+    std::mt19937_64 gen(42);
+    char buffer[64];
+
+    // The shortest representations have at most 17 digits, which Eisel-Lemire rounds correctly
+    for (int i = 0; i < 100000; ++i)
+    {
+        T value;
+        BOOST_IF_CONSTEXPR (std::is_same<T, float>::value)
+        {
+            const auto bits = static_cast<std::uint32_t>(gen());
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+        else
+        {
+            const std::uint64_t bits = gen();
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        check<T>(std::string(buffer, r.ptr), true);
+    }
+}
+
+template <typename T>
+void test_long()
+{
+    std::mt19937_64 gen(42);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::string text;
+        if (gen() % 2 == 0)
+        {
+            text += '-';
+        }
+
+        // 20 to 800 significant digits, sometimes after leading zeros or with a fraction
+        const int digits = 20 + static_cast<int>(gen() % (i % 10 == 0 ? 780 : 30));
+        const int point = static_cast<int>(gen() % static_cast<std::uint64_t>(digits + 2));
+        if (gen() % 4 == 0)
+        {
+            text += "0.000";
+        }
+        text += static_cast<char>('1' + gen() % 9);
+        for (int k = 1; k < digits; ++k)
+        {
+            if (k == point && text.find('.') == std::string::npos)
+            {
+                text += '.';
+            }
+            text += static_cast<char>('0' + gen() % 10);
+        }
+
+        if (gen() % 2 == 0)
+        {
+            text += 'e';
+            text += std::to_string(static_cast<int>(gen() % 700) - 350);
+        }
+
+        check<T>(text, false);
+    }
+}
+
+// Halfway between two doubles in the first 19 digits, and above it only in the digits after them
+void test_halfway()
+{
+    const char* const texts[] = {
+        "9007199254740993", "9007199254740993.000000000000000000001", "9007199254740993.00000000000000000000000000001",
+        "9007199254740992999999999999999999999", "2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324",
+        "2.2250738585072011e-308", "2.22507385850720113605740979670913197593481954635164564e-308", "1.7976931348623158e308",
+        "1.797693134862315807937289714053034150799341327710680e308", "1e400", "1e-400", "0.0000000000000000000000000000000000000000"
+    };
+
+    for (const char* text : texts)
+    {
+        check<double>(text, false);
+    }
+
+    // The 19 digits are exactly halfway, so they round to even where the digits after them round up
+    double value = 0;
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("9007199254740993.000000000000000000001", value));
+    BOOST_TEST_EQ(value, 9007199254740992.0);
+    BOOST_TEST(boost::charconv::from_chars("9007199254740993.000000000000000000001", value));
+    BOOST_TEST_EQ(value, 9007199254740994.0);
+
+    // Overflows only in the digits after the first 19
+    value = 0;
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("1.797693134862315807937289714053034150799341327710680e308", value));
+    BOOST_TEST_EQ(value, (std::numeric_limits<double>::max)());
+}
+
+void test_spot()
+{
+    const char* const texts[] = {
+        "", "x", "-", "+1", "inf", "-inf", "nan", "-nan(snan)", ".5", "1.", "1e", "1e+", "0", "-0", "1e39", "1e-50", "3.4028236e38"
+    };
+
+    for (const char* text : texts)
+    {
+        check<float>(text, true);
+        check<double>(text, true);
+    }
+
+    // The same grammar as from_chars for the other formats
+    double value = 42;
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("01", value, boost::charconv::chars_format::json).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("nan", value, boost::charconv::chars_format::json).ec == std::errc::invalid_argument);
+    const char* fixed = "1e5";
+    BOOST_TEST(boost::charconv::from_chars_fast_approx(fixed, fixed + 3, value, boost::charconv::chars_format::fixed).ptr == fixed + 1);
+    BOOST_TEST_EQ(value, 1.0);
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("1.5", value, boost::charconv::chars_format::scientific).ec == std::errc::invalid_argument);
+    BOOST_TEST(boost::charconv::from_chars_fast_approx("1p5", value, boost::charconv::chars_format::hex).ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, 1.0);
+}
+
+int main()
+{
+    test_shortest<float>();
+    test_shortest<double>();
+    test_long<float>();
+    test_long<double>();
+    test_halfway();
+    test_spot();
+
+    return boost::report_errors();
+}
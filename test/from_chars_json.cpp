@@ -0,0 +1,373 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// chars_format::json must reject what RFC 8259 does not allow, and give the results of chars_format::general otherwise
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <random>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+// Length of the JSON number at the start of text, or 0 if it does not start with one:
+// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?, where a number that is cut short is not one
+std::size_t json_number_length(const std::string& text)
+{
+    const auto is_digit = [&](std::size_t i) { return i < text.size() && text[i] >= '0' && text[i] <= '9'; };
+
+    std::size_t i = 0;
+    if (i < text.size() && text[i] == '-')
+    {
+        ++i;
+    }
+
+    if (!is_digit(i) || (text[i] == '0' && is_digit(i + 1)))
+    {
+        return 0;
+    }
+
+    while (is_digit(i))
+    {
+        ++i;
+    }
+
+    if (i < text.size() && text[i] == '.')
+    {
+        ++i;
+        if (!is_digit(i))
+        {
+            return 0;
+        }
+        while (is_digit(i))
+        {
+            ++i;
+        }
+    }
+
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E'))
+    {
+        ++i;
+        if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+        {
+            ++i;
+        }
+        if (!is_digit(i))
+        {
+            return 0;
+        }
+        while (is_digit(i))
+        {
+            ++i;
+        }
+    }
+
+    return i;
+}
+
+// Not memcmp, since long double has padding bytes
+template <typename T>
+bool same_value(T a, T b)
+{
+    return (a == b && std::signbit(a) == std::signbit(b)) || (a != a && b != b);
+}
+
+// check_ptr is false for the types whose general parser stops early on some valid numbers (e.g. at the e of 0e5,
+// or with an error for a zero followed by a delimiter), where JSON gives the same results
+template <typename T>
+void check_float(const std::string& text, bool check_ptr = true)
+{
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+    const std::size_t length = json_number_length(text);
+
+    T value = T(42);
+    const auto r = boost::charconv::from_chars(first, last, value, boost::charconv::chars_format::json);
+
+    if (length == 0)
+    {
+        if (!BOOST_TEST(r.ec == std::errc::invalid_argument && r.ptr == first))
+        {
+            std::cerr << "Accepted: " << text << std::endl; // LCOV_EXCL_LINE
+        }
+        BOOST_TEST(value == T(42));
+        return;
+    }
+
+    T expected_value = T(42);
+    auto expected = boost::charconv::from_chars(first, last, expected_value, boost::charconv::chars_format::general);
+
+    // The general parser of long double reads past a second dot after a long significand, which JSON does not
+    if (expected.ptr > first + length)
+    {
+        expected_value = T(42);
+        expected = boost::charconv::from_chars(first, first + length, expected_value, boost::charconv::chars_format::general);
+    }
+    if (!BOOST_TEST(r == expected) || (check_ptr && !BOOST_TEST(r.ptr == first + length)))
+    {
+        std::cerr << "Text: " << text << std::endl; // LCOV_EXCL_LINE
+    }
+    BOOST_TEST(same_value(value, expected_value));
+}
+
+template <typename Integer>
+void check_integer(const std::string& text)
+{
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+
+    // Only the integer part of a JSON number is read
+    const auto is_digit = [&](std::size_t i) { return i < text.size() && text[i] >= '0' && text[i] <= '9'; };
+    const std::size_t i = !text.empty() && text[0] == '-';
+    const bool valid = is_digit(i) && !(text[i] == '0' && is_digit(i + 1));
+
+    Integer value = 42;
+    const auto r = boost::charconv::from_chars(first, last, value, boost::charconv::chars_format::json);
+
+    Integer expected_value = 42;
+    const auto expected = boost::charconv::from_chars(first, last, expected_value);
+
+    if (valid)
+    {
+        BOOST_TEST(r == expected);
+        BOOST_TEST(value == expected_value);
+    }
+    else
+    {
+        if (!BOOST_TEST(r.ec == std::errc::invalid_argument && r.ptr == first))
+        {
+            std::cerr << "Accepted: " << text << std::endl; // LCOV_EXCL_LINE
+        }
+        BOOST_TEST(value == 42);
+    }
+}
+
+void check_others(const std::string& text)
+{
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+    const std::size_t length = json_number_length(text);
+
+    double expected_value {};
+    const auto expected = boost::charconv::from_chars(first, last, expected_value, boost::charconv::chars_format::json);
+
+    // from_chars_padded
+    std::vector<char> buffer(text.size() + boost::charconv::from_chars_padding, '5');
+    std::memcpy(buffer.data(), first, text.size());
+    double padded_value = 42;
+    const auto padded = boost::charconv::from_chars_padded(buffer.data(), buffer.data() + text.size(), padded_value, boost::charconv::chars_format::json);
+    BOOST_TEST(padded.ec == expected.ec);
+    BOOST_TEST(padded.ptr - buffer.data() == expected.ptr - first);
+    if (expected)
+    {
+        BOOST_TEST(same_value(padded_value, expected_value));
+    }
+
+    // from_chars_number
+    boost::charconv::number number;
+    number.kind = boost::charconv::number_kind::uint64;
+    number.uint64 = 42;
+    const auto nr = boost::charconv::from_chars_number(first, last, number, boost::charconv::chars_format::json);
+    if (length == 0)
+    {
+        BOOST_TEST(nr.ec == std::errc::invalid_argument && nr.ptr == first);
+        BOOST_TEST(number.kind == boost::charconv::number_kind::uint64 && number.uint64 == 42);
+    }
+    else
+    {
+        boost::charconv::number general_number;
+        const auto gr = boost::charconv::from_chars_number(first, last, general_number);
+        BOOST_TEST(nr == gr);
+        if (gr)
+        {
+            BOOST_TEST(number.kind == general_number.kind);
+            BOOST_TEST_EQ(number.uint64, general_number.uint64);
+        }
+    }
+
+    // parse_decimal
+    boost::charconv::decimal_parts<std::uint64_t> parts {};
+    const auto pr = boost::charconv::parse_decimal(first, last, parts, boost::charconv::chars_format::json);
+    if (length == 0)
+    {
+        BOOST_TEST(pr.ec == std::errc::invalid_argument && pr.ptr == first);
+    }
+    else
+    {
+        boost::charconv::decimal_parts<std::uint64_t> general_parts {};
+        BOOST_TEST(pr == boost::charconv::parse_decimal(first, last, general_parts));
+        BOOST_TEST(parts.significand == general_parts.significand && parts.exponent == general_parts.exponent);
+    }
+}
+
+void check(const std::string& text)
+{
+    check_float<float>(text);
+    check_float<double>(text);
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    check_float<long double>(text, false);
+    #endif
+    check_integer<int>(text);
+    check_integer<long long>(text);
+    check_integer<unsigned>(text);
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    check_integer<boost::int128_type>(text);
+    check_integer<boost::uint128_type>(text);
+    #endif
+    check_others(text);
+}
+
+void test_spot()
+{
+    const char* const valid[] = {
+        "0", "-0", "1", "-1", "10", "0.5", "-0.5", "1.25e3", "1E3", "1e+3", "1e-3", "0e0", "0E+0", "-0.0e-0", "0.000001",
+        "123456789012345678901234567890", "1.7976931348623157e308", "5e-324", "1e400", "-1e400", "1e-400",
+        "9223372036854775807", "18446744073709551616", "1x", "0x1", "1.5e3]", "1,2", "0.5.5", "-7 ", "3.14159265358979323846"
+    };
+
+    for (const char* text : valid)
+    {
+        BOOST_TEST(json_number_length(text) != 0);
+        check(text);
+    }
+
+    const char* const invalid[] = {
+        "", "-", "+1", "+0", "01", "-01", "00", "00.5", ".5", "-.5", "1.", "-1.", "1.e5", "1e", "1e+", "1E-", "1ee5",
+        "inf", "-inf", "infinity", "nan", "NaN", "-nan", "nan(snan)", " 1", "e5", ".", "-e5", "--1", "-+1"
+    };
+
+    for (const char* text : invalid)
+    {
+        BOOST_TEST_EQ(json_number_length(text), 0U);
+        check(text);
+    }
+
+    // Integers only look at the integer part
+    int i = 0;
+    BOOST_TEST(boost::charconv::from_chars("12.5", i, boost::charconv::chars_format::json));
+    BOOST_TEST_EQ(i, 12);
+    BOOST_TEST(boost::charconv::from_chars("ff", i, boost::charconv::chars_format::hex));
+    BOOST_TEST_EQ(i, 255);
+    BOOST_TEST(boost::charconv::from_chars("-010", i, boost::charconv::chars_format::json).ec == std::errc::invalid_argument);
+}
+
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    const char* const pieces[] = {"-", "+", ".", "e", "E", "e-", "e+", "0", "00", "x", ",", " ", "inf", "nan"};
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::string text;
+        const int count = static_cast<int>(gen() % 6);
+        for (int j = 0; j < count; ++j)
+        {
+            if (gen() % 2 == 0)
+            {
+                text += pieces[gen() % (sizeof(pieces) / sizeof(pieces[0]))];
+            }
+            else
+            {
+                const int digits = 1 + static_cast<int>(gen() % 24);
+                for (int k = 0; k < digits; ++k)
+                {
+                    text += static_cast<char>('0' + gen() % 10);
+                }
+            }
+        }
+
+        check(text);
+    }
+}
+
+void test_from_chars_n()
+{
+    const std::string text = "1,-0.5,01,2e3,.5,1.,inf,-0";
+    double values[8];
+    std::uint64_t failed = 0;
+    boost::charconv::from_chars_n(text.data(), text.data() + text.size(), values, 8, &failed, boost::charconv::chars_format::json);
+
+    BOOST_TEST_EQ(failed, UINT64_C(0x74));
+    BOOST_TEST_EQ(values[0], 1.0);
+    BOOST_TEST_EQ(values[1], -0.5);
+    BOOST_TEST_EQ(values[3], 2000.0);
+    BOOST_TEST(values[7] == 0 && std::signbit(values[7]));
+}
+
+// Zeros with an exponent, or followed by a sign, where the long double and __float128 parsers used to stop early
+template <typename T>
+void test_zero_exponent()
+{
+    struct zero_case
+    {
+        const char* text;
+        std::ptrdiff_t length;
+        bool negative;
+    };
+
+    const zero_case cases[] = {{"0e10", 4, false}, {"-0E+1", 5, true}, {"0-6", 1, false}, {"0+493", 1, false}, {"-0e-0,", 5, true}};
+
+    for (const auto& c : cases)
+    {
+        const char* const last = c.text + std::strlen(c.text);
+        for (const auto fmt : {boost::charconv::chars_format::json, boost::charconv::chars_format::general})
+        {
+            T value = 42;
+            const auto r = boost::charconv::from_chars(c.text, last, value, fmt);
+            if (!BOOST_TEST(r) || !BOOST_TEST_EQ(r.ptr - c.text, c.length))
+            {
+                std::cerr << "Text: " << c.text << std::endl; // LCOV_EXCL_LINE
+            }
+            BOOST_TEST(value == 0);
+            BOOST_TEST_EQ(value < 0 || 1 / value < 0, c.negative);
+        }
+    }
+}
+
+// to_chars prints chars_format::json as chars_format::general
+void test_to_chars()
+{
+    const double values[] = {0.0, -1.5, 1e-7, 123456789.0, 1e300, std::numeric_limits<double>::infinity()};
+    for (const double value : values)
+    {
+        char json[64];
+        char general[64];
+        const auto r1 = boost::charconv::to_chars(json, json + sizeof(json), value, boost::charconv::chars_format::json);
+        const auto r2 = boost::charconv::to_chars(general, general + sizeof(general), value, boost::charconv::chars_format::general);
+        BOOST_TEST(r1 && r2);
+        BOOST_TEST_EQ(std::string(json, r1.ptr), std::string(general, r2.ptr));
+
+        const auto r3 = boost::charconv::to_chars(json, json + sizeof(json), value, boost::charconv::chars_format::json, 3);
+        const auto r4 = boost::charconv::to_chars(general, general + sizeof(general), value, boost::charconv::chars_format::general, 3);
+        BOOST_TEST_EQ(std::string(json, r3.ptr), std::string(general, r4.ptr));
+    }
+
+    char json[256];
+    char general[256];
+    const auto r1 = boost::charconv::to_chars_n(json, json + sizeof(json), values, 6, boost::charconv::chars_format::json);
+    const auto r2 = boost::charconv::to_chars_n(general, general + sizeof(general), values, 6, boost::charconv::chars_format::general);
+    BOOST_TEST_EQ(std::string(json, r1.ptr), std::string(general, r2.ptr));
+}
+
+int main()
+{
+    test_spot();
+    test_random();
+    test_from_chars_n();
+    test_to_chars();
+
+    test_zero_exponent<double>();
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    test_zero_exponent<long double>();
+    #endif
+    #ifdef BOOST_CHARCONV_HAS_QUADMATH
+    test_zero_exponent<__float128>();
+    #endif
+
+    return boost::report_errors();
+}
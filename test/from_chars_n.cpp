@@ -0,0 +1,265 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_n must parse each value exactly as from_chars does, and report the values it could not parse
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+bool is_failed(const std::vector<std::uint64_t>& failed, std::size_t i)
+{
+    return ((failed[i / 64] >> (i % 64)) & 1U) != 0;
+}
+
+void test_strings(const std::vector<std::string>& strings, boost::charconv::chars_format fmt, char separator)
+{
+    std::string text;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+    {
+        if (i != 0)
+        {
+            text += separator;
+        }
+        text += strings[i];
+    }
+
+    const std::size_t n = strings.size();
+    std::vector<double> values(n, 42.0);
+    std::vector<std::uint64_t> failed((n + 63) / 64, ~static_cast<std::uint64_t>(0));
+
+    const auto r = boost::charconv::from_chars_n(text.data(), text.data() + text.size(), values.data(), n, failed.data(), fmt, separator);
+    BOOST_TEST(r.ptr == text.data() + text.size());
+
+    std::errc first_error {};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double expected = 42.0;
+        const auto r_single = boost::charconv::from_chars(strings[i].data(), strings[i].data() + strings[i].size(), expected, fmt);
+        const bool single_failed = !r_single || r_single.ptr != strings[i].data() + strings[i].size();
+        if (single_failed)
+        {
+            expected = 42.0;
+        }
+
+        if (single_failed && first_error == std::errc())
+        {
+            // A value that does not take up its whole field fails with invalid_argument
+            first_error = r_single.ptr == strings[i].data() + strings[i].size() ? r_single.ec : std::errc::invalid_argument;
+        }
+
+        BOOST_TEST_EQ(is_failed(failed, i), single_failed);
+        if (!BOOST_TEST(std::memcmp(&values[i], &expected, sizeof(double)) == 0 || (std::isnan(values[i]) && std::isnan(expected))))
+        {
+            std::cerr << "String: " << strings[i] << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    BOOST_TEST(r.ec == first_error);
+}
+
+std::string random_string(std::mt19937_64& gen, boost::charconv::chars_format fmt, char separator)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+    char buffer[512];
+    const auto kind = dist(gen) % 8U;
+
+    if (kind == 0)
+    {
+        // A random double in its shortest representation
+        const std::uint64_t bits = dist(gen);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        return std::string(buffer, r.ptr);
+    }
+    if (kind == 1)
+    {
+        // Ties and near ties which need more than 19 digits
+        const double value = std::ldexp(static_cast<double>(dist(gen) >> 11), static_cast<int>(dist(gen) % 100U) - 50);
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, 30);
+        return std::string(buffer, r.ptr);
+    }
+    if (kind == 2 && fmt != boost::charconv::chars_format::hex)
+    {
+        // Out of range
+        return dist(gen) % 2U == 0 ? "1e999" : "-1e-999";
+    }
+    if (kind == 3)
+    {
+        // Empty fields can not be told apart from a longer separator when it is a space or a tab,
+        // and the hex parser accepts an empty string
+        const bool allow_empty = separator != ' ' && separator != '\t' && fmt != boost::charconv::chars_format::hex;
+        const char* special[] = {"inf", "-nan", "nan(snan)", "infinity", "abc", "1.5x", "-", "0", "-0", ""};
+        return special[dist(gen) % (allow_empty ? 10U : 9U)];
+    }
+
+    // Short values as they appear in data files
+    const double value = static_cast<double>(static_cast<std::int64_t>(dist(gen) % 2000001U) - 1000000) / std::pow(10.0, static_cast<double>(dist(gen) % 8U));
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+    return std::string(buffer, r.ptr);
+}
+
+// Lengths around the 16 digits and 32 characters the implementation looks at in one go
+void test_lengths()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed};
+
+    std::vector<std::string> strings = {"1.", ".5", "-.5", "-", ".", "1e", "1e+", "1e-5", "1E5", "1e+0005", "5e-324", "2e-324", "1e400",
+                                        "0.0000000000000000000000000000000001", "00000000000000000000000000000001.5",
+                                        "1.000000000000000000000000000000000000001", "1234567890123456789e-10", "12345678901234567890e-10",
+                                        "9007199254740993", "9007199254740992.5", "0.30000000000000004", "123456789012345678"};
+
+    for (int digits = 1; digits < 36; ++digits)
+    {
+        for (int point = 0; point <= digits; ++point)
+        {
+            std::string str;
+            for (int i = 0; i < digits; ++i)
+            {
+                if (i == point)
+                {
+                    str += '.';
+                }
+                str += static_cast<char>('1' + (i * 7) % 9);
+            }
+            strings.push_back(str);
+            strings.push_back(str + "e-7");
+        }
+    }
+
+    // Enough text after the values that none of them is close to the end
+    for (int i = 0; i < 8; ++i)
+    {
+        strings.emplace_back("12345.6789");
+    }
+
+    for (const auto fmt : formats)
+    {
+        test_strings(strings, fmt, ',');
+    }
+}
+
+void test_layout()
+{
+    double values[4];
+    std::uint64_t failed;
+
+    // Spaces around values, line breaks between rows and blank lines
+    const char* text = " 1.5 ,2\r\n\n-3e2,\t4 \n";
+    auto r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 4, &failed);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text + std::strlen(text));
+    BOOST_TEST_EQ(failed, 0U);
+    BOOST_TEST_EQ(values[0], 1.5);
+    BOOST_TEST_EQ(values[1], 2.0);
+    BOOST_TEST_EQ(values[2], -300.0);
+    BOOST_TEST_EQ(values[3], 4.0);
+
+    // A space separator allows any number of spaces
+    text = "1   2\t3\n4";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 4, &failed, boost::charconv::chars_format::general, ' ');
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(values[3], 4.0);
+
+    // Empty and malformed fields fail on their own, and are left unmodified
+    values[1] = 42.0;
+    values[2] = 42.0;
+    text = "1,,2x,3";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 4, &failed);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == text + std::strlen(text));
+    BOOST_TEST_EQ(failed, 6U);
+    BOOST_TEST_EQ(values[0], 1.0);
+    BOOST_TEST_EQ(values[1], 42.0);
+    BOOST_TEST_EQ(values[2], 42.0);
+    BOOST_TEST_EQ(values[3], 3.0);
+
+    // Too few values
+    text = "1,2";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 4, &failed);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == text + 3);
+    BOOST_TEST_EQ(failed, 12U);
+
+    // Stops after n values, past their separator, so that the next call can continue there
+    text = "1,2,3";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 2);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text + 4);
+    r = boost::charconv::from_chars_n(r.ptr, text + std::strlen(text), values + 2, 1);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text + 5);
+    BOOST_TEST_EQ(values[2], 3.0);
+
+    // A field must hold nothing but the value
+    text = "1,2]";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 2, &failed);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(failed, 2U);
+
+    // Out of range values are reported as from_chars does
+    text = "1e999,5";
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 2, &failed);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(failed, 1U);
+    BOOST_TEST_EQ(values[1], 5.0);
+
+    // No values
+    r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 0, nullptr);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text);
+}
+
+void test_doc_example()
+{
+    const char* text = "1.5,-0.25,1e+300";
+    double values[3];
+    auto r = boost::charconv::from_chars_n(text, text + std::strlen(text), values, 3);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(values[0], 1.5);
+    BOOST_TEST_EQ(values[1], -0.25);
+    BOOST_TEST_EQ(values[2], 1e300);
+}
+
+int main()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+    constexpr char separators[] = {',', ' ', ';', '\t'};
+
+    std::mt19937_64 gen(42);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        // Sizes around the block size of the implementation
+        std::vector<std::string> strings(gen() % 100U);
+        const auto fmt = formats[i % 4];
+        const auto separator = separators[(i / 4) % 4];
+
+        for (auto& str : strings)
+        {
+            str = random_string(gen, fmt, separator);
+        }
+
+        test_strings(strings, fmt, separator);
+    }
+
+    test_lengths();
+    test_layout();
+    test_doc_example();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_number must give the result and the value of from_chars for the type it picks
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <random>
+#include <limits>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+// What a JSON library would do with two scans: look for a fraction or an exponent, then parse as that type
+void check(const std::string& text)
+{
+    const char* const first = text.data();
+    const char* const last = first + text.size();
+
+    boost::charconv::number value;
+    value.kind = boost::charconv::number_kind::uint64;
+    value.uint64 = 12345;
+    const auto r = boost::charconv::from_chars_number(first, last, value);
+
+    const char* p = first;
+    const bool negative = p != last && *p == '-';
+    p += negative;
+    while (p != last && *p >= '0' && *p <= '9')
+    {
+        ++p;
+    }
+
+    const bool has_digits = p != first + negative;
+    const bool has_exponent = p != last && (*p == 'e' || *p == 'E') &&
+                              ((p + 1 != last && p[1] >= '0' && p[1] <= '9') ||
+                               (p + 2 < last && (p[1] == '+' || p[1] == '-') && p[2] >= '0' && p[2] <= '9'));
+
+    if (has_digits && (p == last || *p != '.') && !has_exponent)
+    {
+        std::int64_t i {};
+        auto expected = boost::charconv::from_chars(first, last, i);
+        if (expected)
+        {
+            BOOST_TEST(r == expected);
+            BOOST_TEST(value.kind == boost::charconv::number_kind::int64);
+            BOOST_TEST_EQ(value.int64, i);
+            return;
+        }
+
+        std::uint64_t u {};
+        expected = boost::charconv::from_chars(first, last, u);
+        if (expected)
+        {
+            BOOST_TEST(r == expected);
+            BOOST_TEST(value.kind == boost::charconv::number_kind::uint64);
+            BOOST_TEST_EQ(value.uint64, u);
+            return;
+        }
+    }
+
+    double d {};
+    const auto expected = boost::charconv::from_chars(first, last, d);
+    if (!BOOST_TEST(r == expected))
+    {
+        std::cerr << "Text: " << text << std::endl; // LCOV_EXCL_LINE
+    }
+
+    if (expected)
+    {
+        BOOST_TEST(value.kind == boost::charconv::number_kind::double_);
+        BOOST_TEST(std::memcmp(&value.double_, &d, sizeof(d)) == 0 || (std::isnan(d) && std::isnan(value.double_)));
+    }
+    else
+    {
+        BOOST_TEST(value.kind == boost::charconv::number_kind::uint64);
+        BOOST_TEST_EQ(value.uint64, UINT64_C(12345));
+    }
+}
+
+void test_spot()
+{
+    const char* const texts[] = {
+        "0", "-0", "1", "-1", "42", "007", "-007", "12x", "12.", "12.5", ".5", "-.5", "1e5", "1E5", "1e", "1e+", "1e-5",
+        "1.5e300", "1e400", "-1e400", "1e-400", "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+        "-9223372036854775809", "18446744073709551615", "18446744073709551616", "000000000000000000000018446744073709551615",
+        "-000000000000000000000009223372036854775808", "123456789012345678901234567890", "0.000000000000000000000001",
+        "inf", "-inf", "infinity", "nan", "-nan", "nan(snan)", "", "-", "+1", "x", " 1", "--1", "1,2", "1 2", "[1]"
+    };
+
+    for (const char* text : texts)
+    {
+        check(text);
+    }
+
+    boost::charconv::number value;
+    BOOST_TEST(boost::charconv::from_chars_number("-42", value));
+    BOOST_TEST(value.kind == boost::charconv::number_kind::int64 && value.int64 == -42);
+    BOOST_TEST(boost::charconv::from_chars_number("18446744073709551615", value));
+    BOOST_TEST(value.kind == boost::charconv::number_kind::uint64 && value.uint64 == UINT64_MAX);
+    BOOST_TEST(boost::charconv::from_chars_number("4.5e1", value));
+    BOOST_TEST(value.kind == boost::charconv::number_kind::double_ && value.double_ == 45.0);
+}
+
+// Random texts made of the pieces of numbers
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    const char* const pieces[] = {"-", ".", "e", "E", "e-", "e+", "0", "00", "x", ",", " "};
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        std::string text;
+        const int count = static_cast<int>(gen() % 6);
+        for (int j = 0; j < count; ++j)
+        {
+            if (gen() % 2 == 0)
+            {
+                text += pieces[gen() % (sizeof(pieces) / sizeof(pieces[0]))];
+            }
+            else
+            {
+                // Runs of digits of every length, up to past the 20 digits of std::uint64_t
+                const int digits = 1 + static_cast<int>(gen() % 24);
+                for (int k = 0; k < digits; ++k)
+                {
+                    text += static_cast<char>('0' + gen() % 10);
+                }
+            }
+        }
+
+        check(text);
+    }
+
+    // Integers around the limits
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = gen() >> (gen() % 64);
+        check(std::to_string(bits));
+        check("-" + std::to_string(bits));
+        check(std::to_string(bits) + std::to_string(gen() % 10));
+    }
+}
+
+int main()
+{
+    test_spot();
+    test_random();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,185 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// from_chars_padded must give the same results as from_chars, whatever the characters after last are
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+// The padding looks like the continuation of a number, so that reading it as part of the value changes the result
+std::vector<char> padded(const std::string& str, std::mt19937_64& gen)
+{
+    const char padding_chars[] = "0123456789.eE-+p";
+    std::vector<char> buffer(str.begin(), str.end());
+    for (std::size_t i = 0; i < boost::charconv::from_chars_padding; ++i)
+    {
+        buffer.push_back(padding_chars[gen() % (sizeof(padding_chars) - 1)]);
+    }
+    return buffer;
+}
+
+template <typename T>
+void test_integer_string(const std::string& str, int base, std::mt19937_64& gen)
+{
+    const auto buffer = padded(str, gen);
+    const char* first = buffer.data();
+    const char* last = first + str.size();
+
+    T expected = 42;
+    T value = 42;
+    const auto r_expected = boost::charconv::from_chars(first, last, expected, base);
+    const auto r = boost::charconv::from_chars_padded(first, last, value, base);
+
+    BOOST_TEST(r.ec == r_expected.ec);
+    BOOST_TEST(r.ptr == r_expected.ptr);
+    if (!BOOST_TEST(value == expected))
+    {
+        std::cerr << "String: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_integers()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const T value = dist(gen);
+        const int base = i % 10 == 0 ? 2 + i % 35 : 10;
+
+        char buffer[128];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, base);
+        std::string str(buffer, r.ptr);
+
+        // Shorter values, trailing characters and leading zeros
+        str.resize(gen() % (str.size() + 1));
+        if (i % 3 == 0)
+        {
+            str += ",x";
+        }
+        if (i % 7 == 0)
+        {
+            str.insert(str[0] == '-' ? 1U : 0U, std::string(gen() % 24, '0'));
+        }
+
+        test_integer_string<T>(str, base, gen);
+    }
+
+    const char* strings[] = {"", "-", "+1", " 1", "-0", "0", "00000000", "12345678", "123456789", "1234567890123456789",
+                             "12345678901234567890", "18446744073709551615", "18446744073709551616", "9223372036854775807",
+                             "9223372036854775808", "-9223372036854775808", "-9223372036854775809", "-18446744073709551615",
+                             "4294967296", "65536", "-129", "255", "256", "99999999999999999999999", "1/", "1:", "9\x80"};
+    for (const char* str : strings)
+    {
+        test_integer_string<T>(str, 10, gen);
+    }
+}
+
+template <typename T>
+void test_float_string(const std::string& str, boost::charconv::chars_format fmt, std::mt19937_64& gen)
+{
+    const auto buffer = padded(str, gen);
+    const char* first = buffer.data();
+    const char* last = first + str.size();
+
+    T expected = 42;
+    T value = 42;
+    const auto r_expected = boost::charconv::from_chars(first, last, expected, fmt);
+    const auto r = boost::charconv::from_chars_padded(first, last, value, fmt);
+
+    BOOST_TEST(r.ec == r_expected.ec);
+    BOOST_TEST(r.ptr == r_expected.ptr);
+    if (!BOOST_TEST(std::memcmp(&value, &expected, sizeof(T)) == 0 || (std::isnan(value) && std::isnan(expected))))
+    {
+        std::cerr << "String: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T, typename Unsigned>
+void test_floats()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<Unsigned> dist(0, (std::numeric_limits<Unsigned>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto fmt = formats[i % 4];
+        char buffer[512];
+        T value;
+
+        if (i % 3 == 0)
+        {
+            // Short values as they appear in data files
+            value = static_cast<T>(static_cast<double>(static_cast<std::int64_t>(dist(gen) % 2000001U) - 1000000) / std::pow(10.0, static_cast<double>(dist(gen) % 8U)));
+        }
+        else
+        {
+            const Unsigned bits = dist(gen);
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+
+        const auto r = i % 5 == 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, i % 25) :
+                                    boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        std::string str(buffer, r.ptr);
+
+        // Values cut short, e.g. right after the decimal point or the e of the exponent
+        if (i % 4 == 1)
+        {
+            str.resize(gen() % (str.size() + 1));
+        }
+
+        test_float_string<T>(str, fmt, gen);
+    }
+
+    const char* strings[] = {"", "-", "+1", ".", "-.", ".5", "1.", "1e", "1e+", "1e5", "1E-5", "-0", "0e999", "1e999", "-1e-999",
+                             "inf", "-nan", "nan(snan)", "4.9406564584124654e-324", "2.2250738585072014e-308",
+                             "123456789012345678", "1234567890123456789", "12345678901234567890", "0.30000000000000004",
+                             "1234567890123456789012345678901", "12345678901234567890123456789012", "9007199254740993"};
+    for (const auto fmt : formats)
+    {
+        for (const char* str : strings)
+        {
+            test_float_string<T>(str, fmt, gen);
+        }
+    }
+}
+
+int main()
+{
+    test_integers<signed char>();
+    test_integers<unsigned char>();
+    test_integers<short>();
+    test_integers<unsigned short>();
+    test_integers<int>();
+    test_integers<unsigned>();
+    test_integers<long long>();
+    test_integers<unsigned long long>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    std::mt19937_64 gen(42);
+    test_integer_string<boost::int128_type>("-170141183460469231731687303715884105728", 10, gen);
+    test_integer_string<boost::uint128_type>("340282366920938463463374607431768211455", 10, gen);
+    test_integer_string<boost::uint128_type>("123", 10, gen);
+    #endif
+
+    test_floats<float, std::uint32_t>();
+    test_floats<double, std::uint64_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,223 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The null-terminated string overloads must stop at the terminator, whatever follows it, and give the same
+// results as from_chars on [first, first + strlen(first))
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <memory>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+// A copy of str in an allocation of exactly its size, so that reading past the end is caught by sanitizers.
+// str may have characters after its terminator.
+std::unique_ptr<char[]> make_zstr(const std::string& str)
+{
+    std::unique_ptr<char[]> copy(new char[str.size() + 1]);
+    std::memcpy(copy.get(), str.c_str(), str.size() + 1);
+    return copy;
+}
+
+template <typename T>
+void test_integer_string(const std::string& str, int base)
+{
+    const auto zstr = make_zstr(str);
+    const char* first = zstr.get();
+
+    T expected = 42;
+    T value = 42;
+    const auto r_expected = boost::charconv::from_chars(first, first + std::strlen(first), expected, base);
+    const auto r = boost::charconv::from_chars(first, value, base);
+
+    BOOST_TEST(r.ec == r_expected.ec);
+    BOOST_TEST(r.ptr == r_expected.ptr);
+    if (!BOOST_TEST(value == expected))
+    {
+        std::cerr << "String: " << first << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_float_string(const std::string& str, boost::charconv::chars_format fmt)
+{
+    const auto zstr = make_zstr(str);
+    const char* first = zstr.get();
+
+    T expected = 42;
+    T value = 42;
+    const auto r_expected = boost::charconv::from_chars(first, first + std::strlen(first), expected, fmt);
+    const auto r = boost::charconv::from_chars(first, value, fmt);
+
+    BOOST_TEST(r.ec == r_expected.ec);
+    BOOST_TEST(r.ptr == r_expected.ptr);
+    // Compares values rather than bytes, because of the padding of long double
+    if (!BOOST_TEST((value == expected && std::signbit(value) == std::signbit(expected)) || (std::isnan(value) && std::isnan(expected))))
+    {
+        std::cerr << "String: " << first << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// Digits and parts of numbers right after the terminator must not be read
+template <typename T>
+void test_integer_terminator()
+{
+    const std::string strings[] = {std::string("12\0" "34", 5), std::string("-\0" "1", 3), std::string("\0" "1", 2),
+                                   std::string("7f\0" "ff", 5), std::string("0\0" "0", 3), std::string("1\0" "0000000000", 12)};
+    for (const auto& str : strings)
+    {
+        test_integer_string<T>(str, 10);
+        test_integer_string<T>(str, 16);
+    }
+
+    const auto zstr = make_zstr(std::string("12\0" "34", 5));
+    T value = 0;
+    const auto r = boost::charconv::from_chars(zstr.get(), value);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == zstr.get() + 2);
+    BOOST_TEST_EQ(value, T(12));
+}
+
+// The parts of a float that the terminator can cut off. Hex, inf, nan, and errors measure the string with strlen,
+// and have to give the same results.
+template <typename T>
+void test_float_terminator()
+{
+    const std::string strings[] = {std::string("1.5\0" "25", 6), std::string("1.\0" "5", 4), std::string("1\0" ".5", 4),
+                                   std::string(".\0" "5", 3), std::string("1e\0" "5", 4), std::string("1e+\0" "5", 5),
+                                   std::string("1e5\0" "5", 5), std::string("-\0" "1", 3), std::string("\0" "1", 2),
+                                   std::string("12345678901234567890\0" "1", 22), std::string("0.1234567890123456789\0" "1e5", 25),
+                                   std::string("inf\0" "inity", 9), std::string("-infin\0" "ity", 10), std::string("nan(\0" ")", 6),
+                                   std::string("nan(snan\0" ")", 10), std::string("1.8p\0" "1", 6), std::string("1.8p1\0" "1", 7),
+                                   std::string("ab\0" "c", 4), std::string("x\0" "1", 3)};
+
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+    for (const auto fmt : formats)
+    {
+        for (const auto& str : strings)
+        {
+            test_float_string<T>(str, fmt);
+        }
+    }
+}
+
+// Random values with the terminator somewhere inside them, and the rest of the value after it
+template <typename T, typename Unsigned>
+void test_float_embedded_terminators()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<Unsigned> dist(0, (std::numeric_limits<Unsigned>::max)());
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto fmt = formats[i % 4];
+        const Unsigned bits = dist(gen);
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        char buffer[512];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        std::string str(buffer, r.ptr);
+        str[gen() % str.size()] = '\0';
+
+        test_float_string<T>(str, fmt);
+    }
+}
+
+template <typename T>
+void test_integer_embedded_terminators()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int base = 2 + i % 35;
+        char buffer[128];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(gen), base);
+        std::string str(buffer, r.ptr);
+        str[gen() % str.size()] = '\0';
+
+        test_integer_string<T>(str, base);
+    }
+}
+
+// long double has no parser of its own for null-terminated strings, and takes the strlen path for everything
+void test_long_double()
+{
+    const std::string strings[] = {std::string("1.25\0" "5", 6), std::string("-1.25e-2\0" "1", 10), std::string("1e99999", 7),
+                                   std::string("inf\0" "inity", 9), std::string("0x1p3", 5), std::string("12\0" "abc", 6),
+                                   std::string("", 0), std::string("-\0" "1", 3)};
+    for (const auto& str : strings)
+    {
+        test_float_string<long double>(str, boost::charconv::chars_format::general);
+        test_float_string<long double>(str, boost::charconv::chars_format::hex);
+    }
+}
+
+// Mutable strings and arrays must pick the null-terminated overloads rather than string_view
+void test_overloads()
+{
+    char buffer[] = "123 456";
+    char* str = buffer;
+
+    int value = 0;
+    auto r = boost::charconv::from_chars(str, value);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == buffer + 3);
+    BOOST_TEST_EQ(value, 123);
+
+    r = boost::charconv::from_chars(buffer + 4, value, 16);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == buffer + 7);
+    BOOST_TEST_EQ(value, 0x456);
+
+    double d = 0;
+    r = boost::charconv::from_chars("-1.5e3", d);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(d, -1500.0);
+}
+
+int main()
+{
+    test_integer_terminator<int>();
+    test_integer_terminator<unsigned>();
+    test_integer_terminator<long long>();
+    test_integer_terminator<unsigned long long>();
+
+    test_integer_embedded_terminators<int>();
+    test_integer_embedded_terminators<unsigned long long>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_integer_string<boost::int128_type>(std::string("-170141183460469231731687303715884105728\0" "1", 42), 10);
+    test_integer_string<boost::uint128_type>(std::string("34028236692093846346337460743176821145\0" "5", 40), 10);
+    #endif
+
+    test_float_terminator<float>();
+    test_float_terminator<double>();
+
+    test_float_embedded_terminators<float, std::uint32_t>();
+    test_float_embedded_terminators<double, std::uint64_t>();
+
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    test_long_double();
+    #endif
+
+    test_overloads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,277 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Streams using the charconv facets must read and write the same as streams in the classic locale
+
+#include <boost/charconv/num_facets.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename CharT>
+std::locale charconv_locale()
+{
+    std::locale loc(std::locale::classic(), new boost::charconv::num_put<CharT>);
+    return std::locale(loc, new boost::charconv::num_get<CharT>);
+}
+
+// Random formatting flags, applied to both streams
+struct format_state
+{
+    std::ios_base::fmtflags flags;
+    std::streamsize precision;
+    std::streamsize width;
+    char fill;
+};
+
+format_state random_format(std::mt19937_64& gen)
+{
+    const std::ios_base::fmtflags floatfields[] = {std::ios_base::fmtflags(), std::ios_base::fixed, std::ios_base::scientific};
+    const std::ios_base::fmtflags basefields[] = {std::ios_base::dec, std::ios_base::oct, std::ios_base::hex, std::ios_base::fmtflags()};
+    const std::ios_base::fmtflags adjustfields[] = {std::ios_base::fmtflags(), std::ios_base::left, std::ios_base::right, std::ios_base::internal};
+
+    format_state state;
+    state.flags = floatfields[gen() % 3] | basefields[gen() % 4] | adjustfields[gen() % 4];
+    state.flags |= gen() % 4 == 0 ? std::ios_base::showpos : std::ios_base::fmtflags();
+    state.flags |= gen() % 4 == 0 ? std::ios_base::uppercase : std::ios_base::fmtflags();
+    state.flags |= gen() % 4 == 0 ? std::ios_base::showbase : std::ios_base::fmtflags();
+    state.precision = static_cast<std::streamsize>(gen() % 40) - 2;
+    state.width = gen() % 3 == 0 ? static_cast<std::streamsize>(gen() % 40) : 0;
+    state.fill = gen() % 2 == 0 ? ' ' : '*';
+    return state;
+}
+
+template <typename CharT, typename T>
+void test_put_value(T value, const format_state& state)
+{
+    std::basic_ostringstream<CharT> expected;
+    std::basic_ostringstream<CharT> actual;
+    actual.imbue(charconv_locale<CharT>());
+
+    for (auto* os : {&expected, &actual})
+    {
+        os->flags(state.flags);
+        os->precision(state.precision);
+        os->width(state.width);
+        os->fill(static_cast<CharT>(state.fill));
+        *os << value << static_cast<CharT>('|') << value;
+    }
+
+    if (!BOOST_TEST(expected.str() == actual.str()))
+    {
+        std::cerr << "Value: " << value << ", flags: " << state.flags << ", precision: " << state.precision << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename CharT, typename T>
+void test_put_integers(std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+    for (int i = 0; i < 20000; ++i)
+    {
+        const T value = i % 10 == 0 ? static_cast<T>(i % 3) : dist(gen);
+        test_put_value<CharT>(value, random_format(gen));
+    }
+}
+
+template <typename CharT>
+void test_put_floats(std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+    const double special[] = {0.0, -0.0, 1.0, 0.1, 100.0, 1e300, 5e-324, HUGE_VAL, -HUGE_VAL,
+                              std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::quiet_NaN()};
+
+    for (int i = 0; i < 50000; ++i)
+    {
+        double value;
+        if (i % 10 == 0)
+        {
+            value = special[static_cast<std::size_t>(i / 10) % (sizeof(special) / sizeof(double))];
+        }
+        else if (i % 3 == 0)
+        {
+            // Short values as they appear in reports
+            value = static_cast<double>(static_cast<std::int64_t>(dist(gen) % 2000001U) - 1000000) / std::pow(10.0, static_cast<double>(dist(gen) % 8U));
+        }
+        else
+        {
+            const std::uint64_t bits = dist(gen);
+            std::memcpy(&value, &bits, sizeof(value));
+        }
+
+        const auto state = random_format(gen);
+        test_put_value<CharT>(value, state);
+        test_put_value<CharT>(static_cast<float>(value), state);
+
+        #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+        if (i % 10 == 0)
+        {
+            test_put_value<CharT>(static_cast<long double>(value), state);
+        }
+        #endif
+    }
+
+    // Fixed output longer than the stack buffer of the implementation
+    format_state state {std::ios_base::fixed, 300, 0, ' '};
+    test_put_value<CharT>(1e300, state);
+    test_put_value<CharT>(-1e-300, state);
+
+    // Hexadecimal floats and showpoint go through std::num_put
+    state = {std::ios_base::fixed | std::ios_base::scientific, 6, 0, ' '};
+    test_put_value<CharT>(1.5, state);
+    state = {std::ios_base::showpoint, 6, 12, ' '};
+    test_put_value<CharT>(100.0, state);
+}
+
+template <typename CharT, typename T>
+void test_get_string(const std::string& str, std::ios_base::fmtflags flags)
+{
+    const std::basic_string<CharT> wide_str(str.begin(), str.end());
+    std::basic_istringstream<CharT> expected(wide_str);
+    std::basic_istringstream<CharT> actual(wide_str);
+    actual.imbue(charconv_locale<CharT>());
+
+    T expected_value = 42;
+    T value = 42;
+    expected.flags(flags);
+    actual.flags(flags);
+    expected >> expected_value;
+    actual >> value;
+
+    BOOST_TEST(expected.rdstate() == actual.rdstate());
+    if (!BOOST_TEST(value == expected_value && std::signbit(value) == std::signbit(expected_value)))
+    {
+        std::cerr << "String: " << str << ", flags: " << flags << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // The same characters are left in the stream
+    expected.clear();
+    actual.clear();
+    BOOST_TEST((std::basic_string<CharT>(std::istreambuf_iterator<CharT>(expected), std::istreambuf_iterator<CharT>()) ==
+                std::basic_string<CharT>(std::istreambuf_iterator<CharT>(actual), std::istreambuf_iterator<CharT>())));
+}
+
+template <typename CharT, typename T>
+void test_get_strings(std::mt19937_64& gen)
+{
+    const char* strings[] = {"", "-", "+", "+-1", "--1", "0", "-0", "+5", "12abc", "0x", "0X1F", "-0x1f", "0xg", "08", "010", "1a",
+                             "9223372036854775807", "9223372036854775808", "-9223372036854775808", "-9223372036854775809",
+                             "18446744073709551615", "18446744073709551616", "-18446744073709551615", "-18446744073709551616",
+                             "4294967295", "4294967296", "-4294967295", "65535", "65536", "-65536", "2147483648", "-2147483649",
+                             "1e", "1e+", "1e+5x", ".", ".5", "+.5", "-.", "1.2.3", "1.e2", ".e1", "e5", "1e5e", "1e+-5", "inf", "nan",
+                             "1e400", "-1e400", "1e-400", "5e-324", "2e-324", "1e39", "-1e-50", "3.4028235e38", "1,5", "1 2",
+                             "0.30000000000000004", "000000000000000000000000000000000000000000000000000000000000000000000012.5",
+                             "123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890e-80"};
+
+    const std::ios_base::fmtflags basefields[] = {std::ios_base::dec, std::ios_base::oct, std::ios_base::hex, std::ios_base::fmtflags()};
+
+    for (const char* str : strings)
+    {
+        for (const auto basefield : basefields)
+        {
+            test_get_string<CharT, T>(str, basefield);
+        }
+    }
+
+    // Random pieces of numbers
+    const char* pieces[] = {"0", "1", "7", "9", "a", "f", "x", "X", "e", "E", "-", "+", ".", " ", "12345678", "99999999999"};
+    for (int i = 0; i < 5000; ++i)
+    {
+        std::string str;
+        const auto length = gen() % 8U;
+        for (std::size_t j = 0; j < length; ++j)
+        {
+            str += pieces[gen() % (sizeof(pieces) / sizeof(pieces[0]))];
+        }
+
+        test_get_string<CharT, T>(str, basefields[gen() % 4]);
+    }
+}
+
+template <typename CharT>
+void test_get_floats(std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+    for (int i = 0; i < 20000; ++i)
+    {
+        const std::uint64_t bits = dist(gen);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+
+        std::ostringstream os;
+        os.precision(static_cast<std::streamsize>(gen() % 20));
+        os << value;
+
+        test_get_string<CharT, double>(os.str(), std::ios_base::dec);
+        test_get_string<CharT, float>(os.str(), std::ios_base::dec);
+    }
+}
+
+template <typename CharT>
+void test_char_type()
+{
+    std::mt19937_64 gen(42);
+
+    test_put_integers<CharT, long>(gen);
+    test_put_integers<CharT, unsigned long>(gen);
+    test_put_integers<CharT, long long>(gen);
+    test_put_integers<CharT, unsigned long long>(gen);
+    test_put_integers<CharT, int>(gen);
+    test_put_integers<CharT, short>(gen);
+    test_put_floats<CharT>(gen);
+
+    test_get_strings<CharT, long>(gen);
+    test_get_strings<CharT, long long>(gen);
+    test_get_strings<CharT, unsigned short>(gen);
+    test_get_strings<CharT, unsigned int>(gen);
+    test_get_strings<CharT, unsigned long>(gen);
+    test_get_strings<CharT, unsigned long long>(gen);
+    test_get_strings<CharT, short>(gen);
+    test_get_strings<CharT, int>(gen);
+    test_get_strings<CharT, float>(gen);
+    test_get_strings<CharT, double>(gen);
+    test_get_floats<CharT>(gen);
+}
+
+void test_doc_example()
+{
+    std::istringstream is("1.5 -2e3 0x1f");
+    is.imbue(std::locale(is.getloc(), new boost::charconv::num_get<char>));
+
+    double a = 0;
+    double b = 0;
+    int c = 0;
+    is >> a >> b >> std::hex >> c;
+    BOOST_TEST(is);
+    BOOST_TEST_EQ(a, 1.5);
+    BOOST_TEST_EQ(b, -2000.0);
+    BOOST_TEST_EQ(c, 31);
+
+    std::ostringstream os;
+    os.imbue(std::locale(os.getloc(), new boost::charconv::num_put<char>));
+    os << std::setprecision(17) << 0.1 << ' ' << std::fixed << std::setprecision(2) << 2.5;
+    BOOST_TEST_EQ(os.str(), "0.10000000000000001 2.50");
+}
+
+int main()
+{
+    test_char_type<char>();
+    test_char_type<wchar_t>();
+    test_doc_example();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,258 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// number_reader must read the values that from_chars reads from each of the tokens,
+// from memory with and without padding, and from files
+
+#include <boost/charconv/number_reader.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
+
+#ifdef BOOST_HAS_UNISTD_H
+#  include <unistd.h>
+#endif
+
+// Random values joined by random separators and comments
+struct test_file
+{
+    std::string text;
+    std::vector<double> doubles;
+    std::vector<long long> integers;
+};
+
+// Stops early when another value could make the text longer than max_size
+test_file make_file(std::mt19937_64& gen, std::size_t count, bool with_comments, std::size_t max_size = static_cast<std::size_t>(-1))
+{
+    const char* separators[] = {" ", ",", "\n", "\r\n", " , ", "\t", ",\n", "  "};
+
+    test_file file;
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+    for (std::size_t i = 0; i < count && file.text.size() + 64 <= max_size; ++i)
+    {
+        if (i != 0 || gen() % 2 == 0)
+        {
+            file.text += separators[gen() % (sizeof(separators) / sizeof(separators[0]))];
+        }
+
+        if (with_comments && gen() % 8 == 0)
+        {
+            file.text += "# 1 2 3, comment\n";
+        }
+
+        char buffer[64];
+        if (i % 2 == 0)
+        {
+            const auto value = static_cast<long long>(dist(gen) >> (gen() % 64)) * (gen() % 2 == 0 ? 1 : -1);
+            file.integers.push_back(value);
+            file.text.append(buffer, boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+        }
+        else
+        {
+            double value;
+            const std::uint64_t bits = dist(gen);
+            std::memcpy(&value, &bits, sizeof(value));
+            if (!std::isfinite(value) || gen() % 2 == 0)
+            {
+                value = static_cast<double>(bits % 1000000) / 1000;
+            }
+
+            file.doubles.push_back(value);
+            const auto fmt = gen() % 3 == 0 ? boost::charconv::chars_format::scientific : boost::charconv::chars_format::general;
+            file.text.append(buffer, boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt).ptr);
+        }
+    }
+
+    if (gen() % 2 == 0)
+    {
+        file.text += '\n';
+    }
+
+    return file;
+}
+
+void check_reader(boost::charconv::number_reader& reader, const test_file& file)
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    for (;;)
+    {
+        if (i + j == file.integers.size() + file.doubles.size())
+        {
+            break;
+        }
+
+        if ((i + j) % 2 == 0)
+        {
+            long long value = 0;
+            BOOST_TEST(reader.read(value));
+            BOOST_TEST_EQ(value, file.integers[i++]);
+        }
+        else
+        {
+            double value = 0;
+            BOOST_TEST(reader.read(value));
+            BOOST_TEST_EQ(value, file.doubles[j++]);
+        }
+
+        if (reader.error() != std::errc())
+        {
+            return; // LCOV_EXCL_LINE
+        }
+    }
+
+    double value = 0;
+    BOOST_TEST(!reader.read(value));
+    BOOST_TEST(reader.error() == std::errc());
+    BOOST_TEST(reader.eof());
+}
+
+void test_memory()
+{
+    std::mt19937_64 gen(42);
+    for (std::size_t count = 0; count < 200; ++count)
+    {
+        const bool with_comments = count % 2 == 0;
+        const test_file file = make_file(gen, count, with_comments);
+
+        // Copied to the start of a buffer that is only as large as the padding requires, so that
+        // reads past the padding are caught by the sanitizers
+        for (const std::size_t padding : {std::size_t(0), std::size_t(10), boost::charconv::from_chars_padding})
+        {
+            std::vector<char> buffer(file.text.begin(), file.text.end());
+            buffer.resize(file.text.size() + padding, '7');
+
+            boost::charconv::number_reader reader(buffer.data(), buffer.data() + file.text.size(), padding);
+            if (with_comments)
+            {
+                reader.set_comment('#');
+            }
+            check_reader(reader, file);
+        }
+    }
+}
+
+void test_errors()
+{
+    const std::string text = "1, 2x, 300 -4,, 5e,  6#7\n8";
+    boost::charconv::number_reader reader(text.data(), text.data() + text.size());
+
+    int value = 0;
+    BOOST_TEST(reader.read(value));
+    BOOST_TEST_EQ(value, 1);
+
+    // A value has to end at a separator
+    BOOST_TEST(!reader.read(value));
+    BOOST_TEST(reader.error() == std::errc::invalid_argument);
+    BOOST_TEST_EQ(reader.position() - text.data(), 3);
+    BOOST_TEST_EQ(value, 1);
+
+    // Reading stops until the value is skipped
+    BOOST_TEST(!reader.read(value));
+    BOOST_TEST(reader.skip());
+    BOOST_TEST(reader.error() == std::errc());
+
+    signed char small = 0;
+    BOOST_TEST(!reader.read(small));
+    BOOST_TEST(reader.error() == std::errc::result_out_of_range);
+    BOOST_TEST(reader.skip());
+
+    BOOST_TEST(reader.read(value));
+    BOOST_TEST_EQ(value, -4);
+
+    double d = 0;
+    BOOST_TEST(!reader.read(d));
+    BOOST_TEST(reader.error() == std::errc::invalid_argument);
+    BOOST_TEST(reader.skip());
+
+    // Without a comment character # is part of the value
+    BOOST_TEST(!reader.read(value));
+    BOOST_TEST(reader.skip());
+    BOOST_TEST(reader.read(value));
+    BOOST_TEST_EQ(value, 8);
+    BOOST_TEST(!reader.skip());
+
+    // Other delimiters, and a base
+    const std::string hex = "ff;10|a\n";
+    boost::charconv::number_reader hex_reader(hex.data(), hex.data() + hex.size());
+    hex_reader.set_delimiters(";|");
+    unsigned sum = 0;
+    while (hex_reader.read(value, 16))
+    {
+        sum += static_cast<unsigned>(value);
+    }
+    BOOST_TEST_EQ(sum, 255U + 16U + 10U);
+    BOOST_TEST(hex_reader.error() == std::errc());
+
+    // Nothing to read
+    boost::charconv::number_reader empty;
+    BOOST_TEST(!empty.read(value));
+    BOOST_TEST(empty.eof());
+}
+
+void test_files()
+{
+    const char* path = "number_reader_test.txt";
+    std::mt19937_64 gen(123);
+
+    // Sizes around the page size, where a mapping has no padding
+    for (const std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(100), std::size_t(4095), std::size_t(4096),
+                                   std::size_t(4097), std::size_t(65536), std::size_t(200000)})
+    {
+        test_file file = make_file(gen, size, true, size);
+        file.text.resize(size, '\n');
+
+        std::FILE* f = std::fopen(path, "wb");
+        BOOST_TEST(f != nullptr);
+        std::fwrite(file.text.data(), 1, file.text.size(), f);
+        std::fclose(f);
+
+        boost::charconv::number_reader reader;
+        reader.set_comment('#');
+        BOOST_TEST(!reader.open(path));
+        BOOST_TEST_EQ(static_cast<std::size_t>(reader.end() - reader.begin()), file.text.size());
+        check_reader(reader, file);
+    }
+
+    std::remove(path);
+
+    boost::charconv::number_reader reader;
+    BOOST_TEST(reader.open("this file does not exist") == std::errc::no_such_file_or_directory);
+    int value = 0;
+    BOOST_TEST(!reader.read(value));
+
+    #ifdef BOOST_HAS_UNISTD_H
+    // A pipe can not be mapped
+    int fds[2];
+    BOOST_TEST_EQ(::pipe(fds), 0);
+    const char text[] = "1 2 3";
+    BOOST_TEST_EQ(::write(fds[1], text, sizeof(text) - 1), static_cast<ssize_t>(sizeof(text) - 1));
+    ::close(fds[1]);
+
+    BOOST_TEST(!reader.open(fds[0]));
+    ::close(fds[0]);
+    int sum = 0;
+    while (reader.read(value))
+    {
+        sum += value;
+    }
+    BOOST_TEST_EQ(sum, 6);
+    #endif
+}
+
+int main()
+{
+    test_memory();
+    test_errors();
+    test_files();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,236 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Whatever the size of the buffer, number_writer must produce the same characters as to_chars
+
+#include <boost/charconv/number_writer.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+#include <random>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+void append_to_string(void* context, const char* data, std::size_t size)
+{
+    static_cast<std::string*>(context)->append(data, size);
+}
+
+// The output of to_chars for each value, with the same separators
+struct expected_output
+{
+    std::string str;
+
+    template <typename T>
+    void add(T value)
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        str.append(buffer, r.ptr);
+    }
+
+    template <typename T>
+    void add(T value, boost::charconv::chars_format fmt)
+    {
+        char buffer[400];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+        BOOST_TEST(r);
+        str.append(buffer, r.ptr);
+    }
+
+    template <typename T>
+    void add(T value, boost::charconv::chars_format fmt, int precision)
+    {
+        std::vector<char> buffer(2000);
+        const auto r = boost::charconv::to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt, precision);
+        BOOST_TEST(r);
+        str.append(buffer.data(), r.ptr);
+    }
+};
+
+const boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                                                 boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex};
+
+template <typename T>
+void test_integers(boost::charconv::number_writer& writer, expected_output& expected, std::mt19937_64& gen)
+{
+    std::uniform_int_distribution<long long> dist((std::numeric_limits<long long>::min)(), (std::numeric_limits<long long>::max)());
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto value = i < 3 ? (i == 0 ? T(0) : i == 1 ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)()) :
+                                   static_cast<T>(dist(gen) >> (gen() % 64));
+        writer.write(value);
+        writer.put(' ');
+        expected.add(value);
+        expected.str += ' ';
+    }
+}
+
+void test_buffer_size(std::size_t size)
+{
+    std::string output;
+    expected_output expected;
+
+    {
+        std::vector<char> buffer(size);
+        boost::charconv::number_writer writer(buffer.data(), buffer.size(), append_to_string, &output);
+        std::mt19937_64 gen(42);
+
+        test_integers<signed char>(writer, expected, gen);
+        test_integers<unsigned char>(writer, expected, gen);
+        test_integers<short>(writer, expected, gen);
+        test_integers<unsigned short>(writer, expected, gen);
+        test_integers<int>(writer, expected, gen);
+        test_integers<unsigned>(writer, expected, gen);
+        test_integers<long>(writer, expected, gen);
+        test_integers<unsigned long>(writer, expected, gen);
+        test_integers<long long>(writer, expected, gen);
+        test_integers<unsigned long long>(writer, expected, gen);
+
+        #ifdef BOOST_CHARCONV_HAS_INT128
+        const boost::int128_type int128_values[] = {0, -1, BOOST_CHARCONV_INT128_MIN, BOOST_CHARCONV_INT128_MAX};
+        for (const auto value : int128_values)
+        {
+            writer.write(value);
+            writer.write(static_cast<boost::uint128_type>(value));
+            expected.add(value);
+            expected.add(static_cast<boost::uint128_type>(value));
+        }
+        #endif
+
+        std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+        const double special[] = {0.0, -0.0, 1.0, 0.1, 1e16, 1e-5, 5e-324, -5e-324, -(std::numeric_limits<double>::max)(),
+                                  -(std::numeric_limits<double>::min)(), HUGE_VAL, -HUGE_VAL, std::numeric_limits<double>::quiet_NaN()};
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            double value;
+            if (i < static_cast<int>(sizeof(special) / sizeof(double)))
+            {
+                value = special[i];
+            }
+            else if (i % 3 == 0)
+            {
+                // Short values as they appear in reports
+                value = static_cast<double>(dist(gen) % 1000000) / 1000;
+            }
+            else
+            {
+                const std::uint64_t bits = dist(gen);
+                std::memcpy(&value, &bits, sizeof(value));
+            }
+
+            writer.write(value);
+            writer.put(',');
+            expected.add(value);
+            expected.str += ',';
+
+            const auto fmt = formats[i % 4];
+            writer.write(value, fmt);
+            writer.append(", ", 2);
+            expected.add(value, fmt);
+            expected.str += ", ";
+
+            const int precision = static_cast<int>(gen() % 40) - 2;
+            writer.write(value, fmt, precision);
+            writer.put(';');
+            expected.add(value, fmt, precision);
+            expected.str += ';';
+
+            const auto float_value = static_cast<float>(value);
+            writer.write(float_value, fmt);
+            writer.put(';');
+            writer.write(float_value, fmt, precision);
+            writer.put('\n');
+            expected.add(float_value, fmt);
+            expected.str += ';';
+            expected.add(float_value, fmt, precision);
+            expected.str += '\n';
+        }
+
+        // Larger than the stack buffers and the most common buffer sizes
+        writer.write(1e300, boost::charconv::chars_format::fixed, 1000);
+        writer.write(-1e-300, boost::charconv::chars_format::general, 1000);
+        expected.add(1e300, boost::charconv::chars_format::fixed, 1000);
+        expected.add(-1e-300, boost::charconv::chars_format::general, 1000);
+
+        const std::string text(5000, 'x');
+        writer.append(text.data(), text.size());
+        expected.str += text;
+
+        BOOST_TEST(writer.size() <= size);
+        writer.flush();
+    }
+
+    BOOST_TEST(output == expected.str);
+}
+
+void test_owned_buffer()
+{
+    std::string output;
+    {
+        boost::charconv::number_writer writer(40, append_to_string, &output);
+        writer.write(-42);
+        writer.put(' ');
+        writer.write(0.1);
+        writer.put(' ');
+        writer.write(123456789012345678ULL);
+        BOOST_TEST_EQ(writer.size(), 26U);
+        BOOST_TEST(output.empty());
+
+        // 18 characters are reserved, and only 14 are left
+        writer.write(2.5, boost::charconv::chars_format::scientific, 2);
+        BOOST_TEST_EQ(output, "-42 0.1 123456789012345678");
+        BOOST_TEST_EQ(writer.size(), 8U);
+
+        writer.flush();
+        BOOST_TEST_EQ(writer.size(), 0U);
+        writer.write(-7);
+        writer.flush();
+    }
+
+    BOOST_TEST_EQ(output, "-42 0.1 1234567890123456782.50e+00-7");
+}
+
+void throw_on_flush(void*, const char*, std::size_t)
+{
+    throw std::runtime_error("flush");
+}
+
+// The exception leaves the writer with output in its buffer, and the destructor must neither call the callback again
+// nor assert
+void test_throwing_callback()
+{
+    bool caught = false;
+    try
+    {
+        boost::charconv::number_writer writer(8, throw_on_flush, nullptr);
+        writer.write(1234567);
+        writer.write(1234567);
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    BOOST_TEST(caught);
+}
+
+int main()
+{
+    for (const std::size_t size : {1U, 7U, 33U, 64U, 329U, 4096U})
+    {
+        test_buffer_size(size);
+    }
+
+    test_owned_buffer();
+    test_throwing_callback();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,155 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Whatever the number of threads, parallel_from_chars must give the values and errors of a single number_reader
+
+#include <boost/charconv/parallel_from_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <stdexcept>
+#include <random>
+#include <atomic>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename T>
+void check_against_reader(const std::string& text, char delimiter)
+{
+    std::vector<T> expected;
+    boost::charconv::number_reader reader(text.data(), text.data() + text.size());
+    const char delimiters[] = {delimiter, '\0'};
+    reader.set_delimiters(delimiters);
+    T value {};
+    while (reader.read(value))
+    {
+        expected.push_back(value);
+    }
+
+    for (const unsigned threads : {0U, 1U, 2U, 3U, 8U})
+    {
+        std::vector<T> values {T(1), T(2)};
+        const auto r = boost::charconv::parallel_from_chars(text.data(), text.data() + text.size(), values, delimiter, threads);
+
+        BOOST_TEST(r.ec == reader.error());
+        BOOST_TEST(r.ptr == (reader.error() == std::errc() ? text.data() + text.size() : reader.position()));
+        BOOST_TEST_EQ(values.size(), expected.size());
+        BOOST_TEST(values == expected);
+    }
+}
+
+// About size characters of values separated by delimiter, with some other white space
+template <typename T>
+std::string make_text(std::mt19937_64& gen, std::size_t size, char delimiter)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+    std::string text;
+    char buffer[64];
+
+    while (text.size() < size)
+    {
+        T value;
+        BOOST_IF_CONSTEXPR (std::is_floating_point<T>::value)
+        {
+            value = static_cast<T>(static_cast<double>(dist(gen) % 2000000) / 1000 - 1000);
+        }
+        else
+        {
+            value = static_cast<T>(dist(gen) >> (gen() % 64));
+        }
+
+        text.append(buffer, boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+        text += gen() % 16 == 0 ? ' ' : delimiter;
+        if (gen() % 32 == 0)
+        {
+            text += "\r\n";
+        }
+    }
+
+    return text;
+}
+
+template <typename T>
+void test_type()
+{
+    std::mt19937_64 gen(42);
+
+    for (const std::size_t size : {std::size_t(0), std::size_t(10), std::size_t(1000), std::size_t(300000), std::size_t(3000000)})
+    {
+        for (const char delimiter : {'\n', ','})
+        {
+            const std::string text = make_text<T>(gen, size, delimiter);
+            check_against_reader<T>(text, delimiter);
+
+            if (text.empty())
+            {
+                continue;
+            }
+
+            // Errors at the start, in the middle, and at the end, where the first one is reported
+            for (const std::size_t position : {std::size_t(0), text.size() / 3, text.size() / 2, text.size() - 1})
+            {
+                std::string bad = text;
+                bad.insert(position, "x");
+                check_against_reader<T>(bad, delimiter);
+
+                bad.insert(bad.size() / 4 * 3, "y");
+                check_against_reader<T>(bad, delimiter);
+            }
+        }
+    }
+}
+
+void test_example()
+{
+    const std::string text = "1.5\n2.25\n-3\n";
+    std::vector<double> values;
+    const auto r = boost::charconv::parallel_from_chars(text.data(), text.data() + text.size(), values);
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text.data() + text.size());
+    BOOST_TEST((values == std::vector<double> {1.5, 2.25, -3}));
+}
+
+// An exception in any of the threads reaches the caller instead of calling std::terminate
+void test_exception()
+{
+    for (const unsigned threads : {1U, 2U, 8U})
+    {
+        std::atomic<std::size_t> calls {0};
+        bool caught = false;
+        try
+        {
+            boost::charconv::detail::parallel_for_each_index(1000, threads, [&calls](std::size_t i) {
+                ++calls;
+                if (i == 10)
+                {
+                    throw std::runtime_error("chunk 10");
+                }
+            });
+        }
+        catch (const std::runtime_error& e)
+        {
+            caught = std::strcmp(e.what(), "chunk 10") == 0;
+        }
+
+        BOOST_TEST(caught);
+        BOOST_TEST(calls.load() < 1000U);
+    }
+}
+
+int main()
+{
+    test_type<int>();
+    test_type<long long>();
+    test_type<unsigned long long>();
+    test_type<float>();
+    test_type<double>();
+    test_example();
+    test_exception();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Whatever the number of threads, parallel_to_chars must write byte for byte what to_chars writes for each value
+
+#include <boost/charconv/parallel_to_chars.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename T>
+std::string sequential_to_chars(const std::vector<T>& values, char separator)
+{
+    std::string text;
+    char buffer[64];
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            text += separator;
+        }
+        text.append(buffer, boost::charconv::to_chars(buffer, buffer + sizeof(buffer), values[i]).ptr);
+    }
+
+    return text;
+}
+
+template <typename T>
+void check_against_to_chars(const std::vector<T>& values, char separator)
+{
+    const std::string expected = sequential_to_chars(values, separator);
+
+    for (const unsigned threads : {0U, 1U, 2U, 3U, 8U})
+    {
+        const std::string text = boost::charconv::parallel_to_chars(values.data(), values.size(), separator, threads);
+        BOOST_TEST_EQ(text.size(), expected.size());
+        BOOST_TEST(text == expected);
+
+        // Into a buffer of exactly the right size, and one that is one character short
+        std::vector<char> buffer(expected.size() + 1, '*');
+        auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + expected.size(), values.data(), values.size(), separator, threads);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == buffer.data() + expected.size());
+        BOOST_TEST(std::string(buffer.data(), expected.size()) == expected);
+        BOOST_TEST_EQ(buffer.back(), '*');
+
+        if (!expected.empty())
+        {
+            r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + expected.size() - 1, values.data(), values.size(), separator, threads);
+            BOOST_TEST(r.ec == std::errc::value_too_large);
+            BOOST_TEST(r.ptr == buffer.data() + expected.size() - 1);
+        }
+    }
+}
+
+template <typename T>
+void test_integers()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (const std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(1000), std::size_t(100000)})
+    {
+        std::vector<T> values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            // Every number of digits
+            values.push_back(static_cast<T>(dist(gen) >> (gen() % 64)));
+        }
+
+        if (size != 0)
+        {
+            values[0] = (std::numeric_limits<T>::min)();
+            values[size - 1] = (std::numeric_limits<T>::max)();
+        }
+
+        check_against_to_chars(values, '\n');
+        check_against_to_chars(values, ',');
+    }
+}
+
+void test_doubles()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    // Around the changes of layout, zeros, subnormals, and values that are not finite
+    std::vector<double> special {0.0, -0.0, 1e-5, -1e-5, 1.0000000000000001e-5, 1e16, 9999999999999998.0, 1e16 + 2,
+                                 18446744073709551616.0, 18446744073709549568.0, 1e100, 1e-100, 1e99, 1e-99, 1.5e308,
+                                 (std::numeric_limits<double>::max)(), (std::numeric_limits<double>::min)(),
+                                 std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::infinity(),
+                                 -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN(),
+                                 -std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::signaling_NaN(),
+                                 1.0, 10.0, 123456789.0, 0.1, 0.001234, 1e15, 123456789012345.6};
+
+    for (double power = 1e-20; power < 1e25; power *= 10)
+    {
+        special.push_back(power);
+        special.push_back(-power * 1.5);
+        special.push_back(std::nextafter(power, 0.0));
+        special.push_back(std::nextafter(power, 1e300));
+    }
+
+    check_against_to_chars(special, '\n');
+
+    for (const std::size_t size : {std::size_t(1), std::size_t(1000), std::size_t(100000)})
+    {
+        std::vector<double> values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            double value;
+            const std::uint64_t bits = dist(gen);
+            std::memcpy(&value, &bits, sizeof(value));
+
+            switch (i % 4)
+            {
+                case 0:
+                    // Any bits
+                    break;
+                case 1:
+                    value = static_cast<double>(bits % 1000000) / 1000;
+                    break;
+                case 2:
+                    value = static_cast<double>(bits >> (gen() % 64));
+                    break;
+                default:
+                    value = special[gen() % special.size()];
+                    break;
+            }
+
+            values.push_back(value);
+        }
+
+        check_against_to_chars(values, '\n');
+        check_against_to_chars(values, ' ');
+    }
+}
+
+void test_example()
+{
+    const double values[] = {1.5, 2.25, -3};
+    BOOST_TEST_EQ(boost::charconv::parallel_to_chars(values, 3), "1.5\n2.25\n-3");
+    BOOST_TEST_EQ(boost::charconv::parallel_to_chars(values, 0, ','), "");
+}
+
+int main()
+{
+    test_integers<int>();
+    test_integers<short>();
+    test_integers<unsigned char>();
+    test_integers<long long>();
+    test_integers<unsigned long long>();
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_integers<boost::int128_type>();
+    test_integers<boost::uint128_type>();
+    #endif
+    test_doubles();
+    test_example();
+
+    return boost::report_errors();
+}
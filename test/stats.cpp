@@ -0,0 +1,128 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Each conversion must add one to the counter of the path it takes in builds of the library with
+// BOOST_CHARCONV_ENABLE_STATS, and every counter must stay zero otherwise
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+struct expected_counts
+{
+    std::uint64_t clinger;
+    std::uint64_t eisel_lemire;
+    std::uint64_t digit_comparison;
+    std::uint64_t strtod;
+    std::uint64_t strtod_malloc;
+};
+
+// Parses text, and checks the counters that it changes
+template <typename T>
+void check(const std::string& text, const expected_counts& counts)
+{
+    const auto before = boost::charconv::stats();
+
+    T value {};
+    BOOST_TEST(boost::charconv::from_chars(text.data(), text.data() + text.size(), value));
+
+    const auto after = boost::charconv::stats();
+    if (!after.enabled)
+    {
+        return;
+    }
+
+    BOOST_TEST_EQ(after.from_chars_clinger - before.from_chars_clinger, counts.clinger);
+    BOOST_TEST_EQ(after.from_chars_eisel_lemire - before.from_chars_eisel_lemire, counts.eisel_lemire);
+    BOOST_TEST_EQ(after.from_chars_digit_comparison - before.from_chars_digit_comparison, counts.digit_comparison);
+    BOOST_TEST_EQ(after.from_chars_strtod - before.from_chars_strtod, counts.strtod);
+    BOOST_TEST_EQ(after.from_chars_strtod_malloc - before.from_chars_strtod_malloc, counts.strtod_malloc);
+    BOOST_TEST_EQ(after.to_chars_printf, before.to_chars_printf);
+}
+
+void test_paths()
+{
+    check<double>("1.5", {1, 0, 0, 0, 0});
+    check<double>("1e300", {0, 1, 0, 0, 0});
+    check<double>("9007199254740993.000000000000000000001", {0, 0, 1, 0, 0});
+    check<float>("0.25", {1, 0, 0, 0, 0});
+    check<float>("3.4028234e38", {0, 1, 0, 0, 0});
+    check<float>("16777217.0000000000000000000000001", {0, 0, 1, 0, 0});
+
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    check<long double>("1e100", {0, 0, 0, 1, 0});
+    check<long double>("1" + std::string(2000, '0') + "e100", {0, 0, 0, 1, 1});
+    #endif
+}
+
+void test_other_functions()
+{
+    const auto before = boost::charconv::stats();
+
+    // from_chars_padded and from_chars_n take the same paths without the full parser
+    std::string text = "1.5";
+    text.append(boost::charconv::from_chars_padding, '\0');
+    double value {};
+    BOOST_TEST(boost::charconv::from_chars_padded(text.data(), text.data() + 3, value));
+
+    const std::string list = "2.5,1e300";
+    double values[2] {};
+    BOOST_TEST(boost::charconv::from_chars_n(list.data(), list.data() + list.size(), values, 2, nullptr).ec == std::errc());
+
+    const auto after = boost::charconv::stats();
+    if (after.enabled)
+    {
+        BOOST_TEST_EQ(after.from_chars_clinger - before.from_chars_clinger, UINT64_C(2));
+        BOOST_TEST_EQ(after.from_chars_eisel_lemire - before.from_chars_eisel_lemire, UINT64_C(1));
+    }
+}
+
+// The counters of threads that have exited stay in the sums
+void test_threads()
+{
+    const auto before = boost::charconv::stats();
+
+    std::thread worker([]
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            double value {};
+            boost::charconv::from_chars("2.5", value);
+        }
+    });
+    worker.join();
+
+    const auto after = boost::charconv::stats();
+    if (after.enabled)
+    {
+        BOOST_TEST_EQ(after.from_chars_clinger - before.from_chars_clinger, UINT64_C(100));
+    }
+}
+
+void test_disabled()
+{
+    const auto snapshot = boost::charconv::stats();
+    if (!snapshot.enabled)
+    {
+        BOOST_TEST_EQ(snapshot.from_chars_clinger, UINT64_C(0));
+        BOOST_TEST_EQ(snapshot.from_chars_eisel_lemire, UINT64_C(0));
+        BOOST_TEST_EQ(snapshot.from_chars_digit_comparison, UINT64_C(0));
+        BOOST_TEST_EQ(snapshot.from_chars_strtod, UINT64_C(0));
+        BOOST_TEST_EQ(snapshot.from_chars_strtod_malloc, UINT64_C(0));
+        BOOST_TEST_EQ(snapshot.to_chars_printf, UINT64_C(0));
+    }
+}
+
+int main()
+{
+    test_paths();
+    test_other_functions();
+    test_threads();
+    test_disabled();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,154 @@
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+using boost::charconv::decimal_parts;
+
+void test_parse(const char* str, std::uint64_t significand, std::int64_t exponent, int digits, bool sign = false,
+                bool truncated = false, chars_format fmt = chars_format::general)
+{
+    decimal_parts<std::uint64_t> parts {};
+    const auto r = boost::charconv::parse_decimal(str, str + std::strlen(str), parts, fmt);
+    if (!(BOOST_TEST(r) && BOOST_TEST(r.ptr == str + std::strlen(str))))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        return;                                      // LCOV_EXCL_LINE
+    }
+
+    BOOST_TEST_EQ(parts.significand, significand);
+    BOOST_TEST_EQ(parts.exponent, exponent);
+    BOOST_TEST_EQ(parts.digits, digits);
+    BOOST_TEST_EQ(parts.sign, sign);
+    BOOST_TEST_EQ(parts.truncated, truncated);
+}
+
+void test_parse_invalid(const char* str, chars_format fmt = chars_format::general)
+{
+    decimal_parts<std::uint64_t> parts {};
+    const auto r = boost::charconv::parse_decimal(str, str + std::strlen(str), parts, fmt);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST(r.ptr == str);
+}
+
+template <typename T>
+void test_round_trip()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        T value;
+        const auto bits = dist(gen);
+        std::memcpy(&value, &bits, sizeof(T));
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+
+        decimal_parts<std::uint64_t> parts {};
+        BOOST_TEST(boost::charconv::to_decimal(value, parts) == std::errc());
+        BOOST_TEST(!parts.truncated);
+
+        // The decomposition must contain exactly the digits to_chars prints
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific);
+        BOOST_TEST(r);
+
+        decimal_parts<std::uint64_t> parsed {};
+        const auto pr = boost::charconv::parse_decimal(buffer, r.ptr, parsed);
+        BOOST_TEST(pr);
+        BOOST_TEST_EQ(parsed.significand, parts.significand);
+        BOOST_TEST_EQ(parsed.exponent, parts.exponent);
+        BOOST_TEST_EQ(parsed.digits, parts.digits);
+        BOOST_TEST_EQ(parsed.sign, parts.sign);
+    }
+}
+
+int main()
+{
+    test_parse("0", 0, 0, 0);
+    test_parse("-0.000", 0, 0, 0, true);
+    test_parse("123", 123, 0, 3);
+    test_parse("-1.25", 125, -2, 3, true);
+    test_parse("0.00125", 125, -5, 3);
+    test_parse(".5", 5, -1, 1);
+    test_parse("5.", 5, 0, 1);
+    test_parse("1.2e10", 12, 9, 2);
+    test_parse("1.2E-10", 12, -11, 2);
+    test_parse("100", 100, 0, 3);
+    test_parse("1e5", 1, 5, 1, false, false, chars_format::scientific);
+    test_parse("18446744073709551615", UINT64_C(1844674407370955161), 1, 20, false, true);
+    test_parse("12345678901234567890000", UINT64_C(1234567890123456789), 4, 23);
+    test_parse("1234567890.1234567890000", UINT64_C(1234567890123456789), -9, 23);
+    test_parse("0.000000000000000000000000000012345678901234567891", UINT64_C(1234567890123456789), -47, 20, false, true);
+
+    // fixed stops at the exponent
+    {
+        const char* str = "1.5e10";
+        decimal_parts<std::uint64_t> parts {};
+        const auto r = boost::charconv::parse_decimal(str, str + std::strlen(str), parts, chars_format::fixed);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == str + 3);
+        BOOST_TEST_EQ(parts.significand, UINT64_C(15));
+        BOOST_TEST_EQ(parts.exponent, INT64_C(-1));
+    }
+
+    test_parse_invalid("");
+    test_parse_invalid("-");
+    test_parse_invalid(".");
+    test_parse_invalid("+1");
+    test_parse_invalid("inf");
+    test_parse_invalid("nan");
+    test_parse_invalid("1.5", chars_format::scientific);
+    test_parse_invalid("1.5", chars_format::hex);
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    {
+        const char* str = "-340282366920938463463374607431768211455";
+        decimal_parts<boost::uint128_type> parts {};
+        const auto r = boost::charconv::parse_decimal(str, str + std::strlen(str), parts);
+        BOOST_TEST(r);
+        BOOST_TEST(parts.significand == static_cast<boost::uint128_type>(BOOST_CHARCONV_UINT128_MAX / 10));
+        BOOST_TEST_EQ(parts.exponent, INT64_C(1));
+        BOOST_TEST_EQ(parts.digits, 39);
+        BOOST_TEST(parts.sign);
+        BOOST_TEST(parts.truncated);
+    }
+    #endif
+
+    {
+        decimal_parts<std::uint64_t> parts {};
+        BOOST_TEST(boost::charconv::to_decimal(0.3, parts) == std::errc());
+        BOOST_TEST_EQ(parts.significand, UINT64_C(3));
+        BOOST_TEST_EQ(parts.exponent, INT64_C(-1));
+        BOOST_TEST_EQ(parts.digits, 1);
+
+        BOOST_TEST(boost::charconv::to_decimal(-0.0, parts) == std::errc());
+        BOOST_TEST_EQ(parts.significand, UINT64_C(0));
+        BOOST_TEST(parts.sign);
+
+        BOOST_TEST(boost::charconv::to_decimal(1e23, parts) == std::errc());
+        BOOST_TEST_EQ(parts.significand, UINT64_C(1));
+        BOOST_TEST_EQ(parts.exponent, INT64_C(23));
+
+        BOOST_TEST(boost::charconv::to_decimal(std::numeric_limits<double>::infinity(), parts) == std::errc::invalid_argument);
+        BOOST_TEST(boost::charconv::to_decimal(std::numeric_limits<float>::quiet_NaN(), parts) == std::errc::invalid_argument);
+    }
+
+    test_round_trip<float>();
+    test_round_trip<double>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,147 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+constexpr int max_digits = 40;
+
+// Expected digits and exponent from printf
+void check_against_printf(double value, int digits)
+{
+    boost::charconv::digit_generator<max_digits> gen(value, digits);
+    BOOST_TEST(gen);
+    BOOST_TEST_EQ(gen.size(), digits);
+    BOOST_TEST_EQ(gen.sign(), std::signbit(value));
+
+    char printf_buffer[128] {};
+    std::snprintf(printf_buffer, sizeof(printf_buffer), "%.*e", digits - 1, std::fabs(value));
+
+    std::string expected_digits;
+    const char* p = printf_buffer;
+    for (; *p != 'e'; ++p)
+    {
+        if (*p != '.')
+        {
+            expected_digits += *p;
+        }
+    }
+    const int expected_exponent = std::atoi(p + 1);
+
+    std::string generated;
+    while (!gen.done())
+    {
+        const auto block = gen.next();
+        char block_buffer[16] {};
+        std::snprintf(block_buffer, sizeof(block_buffer), "%0*u", block.digits, static_cast<unsigned>(block.value));
+        generated += block_buffer;
+    }
+
+    if (!BOOST_TEST_EQ(generated, expected_digits) || !BOOST_TEST_EQ(gen.exponent(), expected_exponent))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(17)
+                  << "Value: " << value
+                  << "\nDigits: " << digits << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+void test_random(bool subnormal)
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 50000; ++i)
+    {
+        auto bits = dist(gen);
+        if (subnormal)
+        {
+            bits &= UINT64_C(0x800FFFFFFFFFFFFF) >> (i % 52);
+        }
+
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value) || value == 0)
+        {
+            continue;
+        }
+
+        check_against_printf(value, 1 + i % max_digits);
+    }
+}
+
+void test_blocks()
+{
+    // 1 / 3 = 0.333333333333333314829616256247390992939472198486328125
+    boost::charconv::digit_generator<30> gen(1.0 / 3.0);
+    BOOST_TEST_EQ(gen.size(), 30);
+    BOOST_TEST_EQ(gen.exponent(), -1);
+
+    auto block = gen.next(4);
+    BOOST_TEST_EQ(block.value, 3333U);
+    BOOST_TEST_EQ(block.digits, 4);
+
+    block = gen.next();
+    BOOST_TEST_EQ(block.value, 333333333U);
+    BOOST_TEST_EQ(block.digits, 9);
+    BOOST_TEST_EQ(gen.remaining(), 17);
+
+    char buffer[32] {};
+    auto ptr = gen.next(buffer, buffer + 5);
+    BOOST_TEST_EQ(ptr - buffer, 5);
+    BOOST_TEST_CSTR_EQ(buffer, "33314");
+
+    ptr = gen.next(buffer, buffer + sizeof(buffer));
+    *ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, "829616256247");
+    BOOST_TEST(gen.done());
+
+    block = gen.next();
+    BOOST_TEST_EQ(block.digits, 0);
+
+    // Rounding carries into the exponent
+    boost::charconv::digit_generator<3> carry(-9999.9);
+    BOOST_TEST(carry.sign());
+    BOOST_TEST_EQ(carry.exponent(), 4);
+    BOOST_TEST_EQ(carry.next().value, 100U);
+
+    boost::charconv::digit_generator<> zero(0.0);
+    BOOST_TEST_EQ(zero.size(), 17);
+    BOOST_TEST_EQ(zero.exponent(), 0);
+    BOOST_TEST_EQ(zero.next().value, 0U);
+
+    boost::charconv::digit_generator<> inf(std::numeric_limits<double>::infinity());
+    BOOST_TEST(!inf);
+    BOOST_TEST(inf.done());
+
+    boost::charconv::digit_generator<> nan(std::numeric_limits<double>::quiet_NaN());
+    BOOST_TEST(!nan);
+}
+
+int main()
+{
+    test_blocks();
+    test_random(false);
+    test_random(true);
+
+    check_against_printf((std::numeric_limits<double>::max)(), max_digits);
+    check_against_printf((std::numeric_limits<double>::min)(), max_digits);
+    check_against_printf(std::numeric_limits<double>::denorm_min(), max_digits);
+    check_against_printf(std::numeric_limits<double>::denorm_min(), 1);
+    check_against_printf(2.5, 1);
+    check_against_printf(3.5, 1);
+
+    return boost::report_errors();
+}
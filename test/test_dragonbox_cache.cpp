@@ -0,0 +1,80 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The compact cache policy must recover exactly the entries of the full table
+
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace boost::charconv::detail;
+
+void test_cache_entries()
+{
+    for (int k = cache_holder_ieee754_binary64::min_k; k <= cache_holder_ieee754_binary64::max_k; ++k)
+    {
+        const auto full = policy_impl::cache::full::get_cache<ieee754_binary64>(k);
+        const auto compact = policy_impl::cache::compact::get_cache<ieee754_binary64>(k);
+
+        if (!BOOST_TEST(full.high == compact.high) || !BOOST_TEST(full.low == compact.low))
+        {
+            std::cerr << "k: " << k << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    for (int k = cache_holder_ieee754_binary32::min_k; k <= cache_holder_ieee754_binary32::max_k; ++k)
+    {
+        BOOST_TEST_EQ(policy_impl::cache::full::get_cache<ieee754_binary32>(k),
+                      policy_impl::cache::compact::get_cache<ieee754_binary32>(k));
+    }
+}
+
+template <typename T>
+void test_to_decimal(T value)
+{
+    const auto full = to_decimal(value, policy::cache::full);
+    const auto compact = to_decimal(value, policy::cache::compact);
+
+    if (!BOOST_TEST_EQ(full.significand, compact.significand) || !BOOST_TEST_EQ(full.exponent, compact.exponent))
+    {
+        std::cerr << "Value: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T, typename Unsigned>
+void test_random()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<Unsigned> dist(0, (std::numeric_limits<Unsigned>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const Unsigned bits = dist(gen);
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (std::isfinite(value) && value != 0)
+        {
+            test_to_decimal(std::fabs(value));
+        }
+    }
+
+    test_to_decimal((std::numeric_limits<T>::max)());
+    test_to_decimal((std::numeric_limits<T>::min)());
+    test_to_decimal(std::numeric_limits<T>::denorm_min());
+}
+
+int main()
+{
+    test_cache_entries();
+    test_random<float, std::uint32_t>();
+    test_random<double, std::uint64_t>();
+
+    return boost::report_errors();
+}
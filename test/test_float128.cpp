@@ -249,6 +249,7 @@ void test_sprintf_float( T value, boost::charconv::chars_format fmt = boost::cha
     switch (fmt)
     {
         case boost::charconv::chars_format::general:
+        case boost::charconv::chars_format::json:
             sprintf_fmt = fmt_from_type(value);
             error_format = "General";
             break;
@@ -0,0 +1,81 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// floff must produce the same digits with the compressed main cache and the super compact extended cache
+// as with the full tables that are used by default
+
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace boost::charconv::detail;
+
+void test_value(double value, int precision, boost::charconv::chars_format fmt)
+{
+    static char full_buffer[1200];
+    static char compact_buffer[1200];
+
+    const auto r_full = floff<main_cache_full, extended_cache_long>(value, precision, full_buffer,
+                                                                    full_buffer + sizeof(full_buffer), fmt);
+    const auto r_compact = floff<main_cache_compressed, extended_cache_super_compact>(value, precision, compact_buffer,
+                                                                                      compact_buffer + sizeof(compact_buffer), fmt);
+
+    BOOST_TEST(r_full.ec == std::errc());
+    BOOST_TEST(r_compact.ec == std::errc());
+
+    if (!BOOST_TEST_EQ(std::string(compact_buffer, r_compact.ptr), std::string(full_buffer, r_full.ptr)))
+    {
+        // LCOV_EXCL_START
+        std::cerr << std::setprecision(17) << "Value: " << value
+                  << "\nPrecision: " << precision
+                  << "\nFormat: " << static_cast<unsigned>(fmt) << std::endl;
+        // LCOV_EXCL_STOP
+    }
+}
+
+int main()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::general};
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = dist(gen) >> 1;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (!std::isfinite(value) || value < (std::numeric_limits<double>::min)())
+        {
+            continue;
+        }
+
+        if (i % 3 == 0)
+        {
+            // Values with few significant digits end in ties
+            value = std::ldexp(static_cast<double>(dist(gen) >> 11), static_cast<int>(dist(gen) % 200U) - 100);
+        }
+
+        const int precision = static_cast<int>(dist(gen) % (i % 2 == 0 ? 120U : 700U)) + 1;
+        test_value(value, precision, formats[i % 3]);
+    }
+
+    // Ties that were rounded up, and the last 18 digit pair of a segment
+    test_value(0x1.34c68e3febf89p+17, 39, boost::charconv::chars_format::scientific);
+    test_value(0x1.1f255c95623c8p-40, 76, boost::charconv::chars_format::scientific);
+    test_value(0x1.c2c0818b3ec09p+279, 29, boost::charconv::chars_format::scientific);
+    test_value(0x1.68dede4b97586p+278, 28, boost::charconv::chars_format::scientific);
+
+    return boost::report_errors();
+}
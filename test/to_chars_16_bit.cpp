@@ -0,0 +1,193 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Exhaustive test of the shortest formatting of binary16 and bfloat16 on the bit patterns,
+// so that it runs whether or not the compiler provides the types themselves
+
+#include <boost/charconv/detail/to_chars_16_bit.hpp>
+#include <boost/charconv/detail/exact_digits.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <string>
+#include <cstdint>
+
+using boost::charconv::detail::ieee754_binary16;
+using boost::charconv::detail::brainfloat16;
+
+// An exact decimal value, digits * 10^(exponent - digits.size() + 1) without trailing zeros
+struct decimal
+{
+    std::string digits;
+    int exponent;
+};
+
+constexpr std::size_t max_limbs = boost::charconv::detail::exact_digits_limbs(140);
+
+// Exact decimal expansion of m * 2^e
+decimal exact_value(std::uint64_t m, int e)
+{
+    char buffer[200];
+    const auto r = boost::charconv::detail::exact_digits<max_limbs>(0, m, e, 200, buffer);
+    BOOST_TEST(!r.overflow);
+
+    std::string digits(buffer, 200);
+    digits.erase(digits.find_last_not_of('0') + 1);
+    return {digits, r.exponent};
+}
+
+decimal from_integer(std::uint64_t d, int power)
+{
+    std::string digits = std::to_string(d);
+    const int exponent = power + static_cast<int>(digits.size()) - 1;
+    digits.erase(digits.find_last_not_of('0') + 1);
+    return {digits, exponent};
+}
+
+int compare(const decimal& lhs, const decimal& rhs)
+{
+    if (lhs.exponent != rhs.exponent)
+    {
+        return lhs.exponent < rhs.exponent ? -1 : 1;
+    }
+
+    const auto n = lhs.digits.size() > rhs.digits.size() ? lhs.digits.size() : rhs.digits.size();
+    const auto l = lhs.digits + std::string(n - lhs.digits.size(), '0');
+    const auto r = rhs.digits + std::string(n - rhs.digits.size(), '0');
+    return l.compare(r) < 0 ? -1 : l == r ? 0 : 1;
+}
+
+// For every length, the closest decimal of that length is the only candidate unless it is outside
+// of the rounding interval, in which case it can only be its neighbour on the other side of the value
+template <typename Layout>
+decimal reference(std::uint16_t bits)
+{
+    constexpr int significand_bits = Layout::significand_bits;
+    const std::uint32_t ieee_significand = bits & ((1U << significand_bits) - 1U);
+    const std::uint32_t ieee_exponent = (bits >> significand_bits) & ((1U << Layout::exponent_bits) - 1U);
+
+    const std::uint64_t c = ieee_exponent != 0 ? (1U << significand_bits) | ieee_significand : ieee_significand;
+    const int q = (ieee_exponent != 0 ? static_cast<int>(ieee_exponent) : 1) + Layout::exponent_bias - significand_bits;
+
+    const bool closer = ieee_significand == 0 && ieee_exponent > 1;
+    const decimal value = exact_value(c, q);
+    const decimal lower = exact_value(closer ? 4 * c - 1 : 2 * c - 1, closer ? q - 2 : q - 1);
+    const decimal upper = exact_value(2 * c + 1, q - 1);
+    const bool inclusive = c % 2 == 0;
+
+    const auto inside = [&](const decimal& d) {
+        const int l = compare(lower, d);
+        const int u = compare(d, upper);
+        return inclusive ? l <= 0 && u <= 0 : l < 0 && u < 0;
+    };
+
+    for (int n = 1; ; ++n)
+    {
+        char buffer[8];
+        const auto r = boost::charconv::detail::exact_digits<max_limbs>(0, c, q, n, buffer);
+        const auto d = std::stoull(std::string(buffer, static_cast<std::size_t>(n)));
+        const int power = r.exponent - n + 1;
+
+        const decimal closest = from_integer(d, power);
+        if (inside(closest))
+        {
+            return closest;
+        }
+
+        const decimal other = from_integer(compare(closest, value) > 0 ? d - 1 : d + 1, power);
+        if (inside(other))
+        {
+            return other;
+        }
+    }
+}
+
+template <typename Layout>
+void test_exhaustive()
+{
+    for (std::uint32_t i = 0; i < 0x8000; ++i)
+    {
+        const auto bits = static_cast<std::uint16_t>(i);
+        if (((i >> Layout::significand_bits) & ((1U << Layout::exponent_bits) - 1U)) == (1U << Layout::exponent_bits) - 1U)
+        {
+            continue; // Inf and NaN
+        }
+
+        const auto result = boost::charconv::detail::to_decimal_16_bit<Layout>(bits);
+        const auto negative = boost::charconv::detail::to_decimal_16_bit<Layout>(static_cast<std::uint16_t>(bits | 0x8000U));
+        BOOST_TEST(!result.is_negative);
+        BOOST_TEST(negative.is_negative);
+        BOOST_TEST_EQ(result.significand, negative.significand);
+
+        if (i == 0)
+        {
+            BOOST_TEST_EQ(result.significand, 0U);
+            continue;
+        }
+
+        const decimal expected = reference<Layout>(bits);
+        const decimal actual = from_integer(result.significand, result.exponent);
+        if (!BOOST_TEST_EQ(actual.digits, expected.digits) || !BOOST_TEST_EQ(actual.exponent, expected.exponent))
+        {
+            std::cerr << "Bits: " << std::hex << i << std::dec << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+template <typename Layout>
+void test_format(std::uint16_t bits, boost::charconv::chars_format fmt, const char* expected)
+{
+    const auto value = boost::charconv::detail::to_decimal_16_bit<Layout>(bits);
+    const std::string expected_str(expected);
+
+    char buffer[64];
+    const auto r = boost::charconv::detail::to_chars_16_bit_shortest(buffer, buffer + sizeof(buffer), value, fmt);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), expected_str);
+
+    // Must fit exactly, and fail with one character less
+    const auto len = static_cast<std::ptrdiff_t>(expected_str.size());
+    const auto r_exact = boost::charconv::detail::to_chars_16_bit_shortest(buffer, buffer + len, value, fmt);
+    BOOST_TEST(r_exact.ptr == buffer + len);
+    const auto r_short = boost::charconv::detail::to_chars_16_bit_shortest(buffer, buffer + len - 1, value, fmt);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+}
+
+int main()
+{
+    test_exhaustive<ieee754_binary16>();
+    test_exhaustive<brainfloat16>();
+
+    constexpr auto general = boost::charconv::chars_format::general;
+    constexpr auto scientific = boost::charconv::chars_format::scientific;
+    constexpr auto fixed = boost::charconv::chars_format::fixed;
+
+    // binary16
+    test_format<ieee754_binary16>(0x3C00, general, "1");
+    test_format<ieee754_binary16>(0x3C00, scientific, "1e+00");
+    test_format<ieee754_binary16>(0x3C00, fixed, "1");
+    test_format<ieee754_binary16>(0x4900, general, "1e+01");
+    test_format<ieee754_binary16>(0x4900, fixed, "10");
+    test_format<ieee754_binary16>(0x57D0, general, "125");
+    test_format<ieee754_binary16>(0xD7D0, scientific, "-1.25e+02");
+    test_format<ieee754_binary16>(0x2E66, general, "0.1");
+    test_format<ieee754_binary16>(0x2E66, scientific, "1e-01");
+    test_format<ieee754_binary16>(0x7BFF, general, "6.55e+04");
+    test_format<ieee754_binary16>(0x7BFF, fixed, "65500");
+    test_format<ieee754_binary16>(0x0001, general, "6e-08");
+    test_format<ieee754_binary16>(0x0001, fixed, "0.00000006");
+    test_format<ieee754_binary16>(0x0000, general, "0");
+    test_format<ieee754_binary16>(0x8000, general, "-0");
+    test_format<ieee754_binary16>(0x8000, scientific, "-0e+00");
+
+    // bfloat16
+    test_format<brainfloat16>(0x3F80, general, "1");
+    test_format<brainfloat16>(0x496B, scientific, "9.63e+05");
+    test_format<brainfloat16>(0x7F7F, general, "3.39e+38");
+    test_format<brainfloat16>(0x0001, scientific, "9e-41");
+    test_format<brainfloat16>(0x0080, scientific, "1.18e-38");
+    test_format<brainfloat16>(0xC2F7, fixed, "-123.5");
+
+    return boost::report_errors();
+}
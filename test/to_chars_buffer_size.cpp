@@ -0,0 +1,96 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The shortest representation must fit into a buffer of exactly its length, and must not fit into one character less
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+template <typename T>
+void check(T value, boost::charconv::chars_format fmt)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+    BOOST_TEST(r);
+    const std::string expected(buffer, r.ptr);
+
+    // A vector of the exact size, so that writing past its end is caught by sanitizers
+    std::vector<char> exact(expected.size());
+    const auto r_exact = boost::charconv::to_chars(exact.data(), exact.data() + exact.size(), value, fmt);
+    if (!BOOST_TEST(r_exact) || !BOOST_TEST(std::string(exact.data(), r_exact.ptr) == expected))
+    {
+        std::cerr << "Value: " << expected << std::endl; // LCOV_EXCL_LINE
+    }
+
+    std::vector<char> short_buffer(expected.size() - 1);
+    const auto r_short = boost::charconv::to_chars(short_buffer.data(), short_buffer.data() + short_buffer.size(), value, fmt);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+}
+
+template <typename T>
+void test_random()
+{
+    using bits_type = typename std::conditional<std::is_same<T, float>::value, std::uint32_t, std::uint64_t>::type;
+
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto bits = static_cast<bits_type>(gen());
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (value != value)
+        {
+            continue;
+        }
+
+        check(value, boost::charconv::chars_format::scientific);
+        check(value, boost::charconv::chars_format::general);
+
+        // Few significant digits, which the printer pads with trailing zeros before dropping them
+        const auto few_digits = static_cast<T>(static_cast<std::int64_t>(gen() % 20000000) - 10000000) / static_cast<T>(100);
+        check(few_digits, boost::charconv::chars_format::scientific);
+        check(few_digits, boost::charconv::chars_format::general);
+    }
+}
+
+void test_spot()
+{
+    // Reported values that failed with buffers of their exact length
+    check(8485.53F, boost::charconv::chars_format::scientific);
+    check(-4685301.5, boost::charconv::chars_format::scientific);
+
+    const float floats[] = {1.0F, 1e10F, 1e-10F, 1e38F, 1e-38F, 1e-45F, 123456.7F, (std::numeric_limits<float>::max)()};
+    const double doubles[] = {1.0, 1e100, 1e-100, 1e300, 1e-300, 5e-324, 1.5e17, 1.2345678901234567e-308,
+                              (std::numeric_limits<double>::max)()};
+
+    for (const auto value : floats)
+    {
+        check(value, boost::charconv::chars_format::scientific);
+        check(value, boost::charconv::chars_format::general);
+        check(-value, boost::charconv::chars_format::general);
+    }
+
+    for (const auto value : doubles)
+    {
+        check(value, boost::charconv::chars_format::scientific);
+        check(value, boost::charconv::chars_format::general);
+        check(-value, boost::charconv::chars_format::scientific);
+    }
+}
+
+int main()
+{
+    test_spot();
+    test_random<float>();
+    test_random<double>();
+
+    return boost::report_errors();
+}
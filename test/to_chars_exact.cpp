@@ -0,0 +1,226 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Formatting with a precision for the values that are printed from their exact decimal expansion
+// (long double, __float128, and double subnormals) must match printf
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+#  include <quadmath.h>
+#endif
+
+constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::scientific,
+                                                     boost::charconv::chars_format::fixed,
+                                                     boost::charconv::chars_format::general};
+
+const char* printf_format(double, boost::charconv::chars_format fmt)
+{
+    return fmt == boost::charconv::chars_format::scientific ? "%.*e" :
+           fmt == boost::charconv::chars_format::fixed ? "%.*f" : "%.*g";
+}
+
+const char* printf_format(long double, boost::charconv::chars_format fmt)
+{
+    return fmt == boost::charconv::chars_format::scientific ? "%.*Le" :
+           fmt == boost::charconv::chars_format::fixed ? "%.*Lf" : "%.*Lg";
+}
+
+template <typename T>
+int reference_snprintf(char* buffer, std::size_t size, T value, boost::charconv::chars_format fmt, int precision)
+{
+    return std::snprintf(buffer, size, printf_format(value, fmt), precision, value);
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+int reference_snprintf(char* buffer, std::size_t size, __float128 value, boost::charconv::chars_format fmt, int precision)
+{
+    const char* format = fmt == boost::charconv::chars_format::scientific ? "%.*Qe" :
+                         fmt == boost::charconv::chars_format::fixed ? "%.*Qf" : "%.*Qg";
+
+    return quadmath_snprintf(buffer, size, format, precision, value);
+}
+#endif
+
+template <typename T>
+void test_value(T value, int precision)
+{
+    // Fixed formatting of the largest long doubles needs almost 5000 characters
+    static char buffer[8192];
+    static char printf_buffer[8192];
+
+    for (const auto fmt : formats)
+    {
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+        if (!BOOST_TEST(r))
+        {
+            continue; // LCOV_EXCL_LINE
+        }
+
+        const auto len = static_cast<std::size_t>(r.ptr - buffer);
+        const auto printf_len = static_cast<std::size_t>(reference_snprintf(printf_buffer, sizeof(printf_buffer), value, fmt, precision));
+
+        if (!BOOST_TEST_EQ(std::string(buffer, len), std::string(printf_buffer, printf_len)))
+        {
+            // LCOV_EXCL_START
+            std::cerr << "Precision: " << precision
+                      << "\nFormat: " << static_cast<unsigned>(fmt) << std::endl;
+            continue;
+            // LCOV_EXCL_STOP
+        }
+
+        // Must fit exactly, and fail with one character less
+        if (len > 20)
+        {
+            const auto r_exact = boost::charconv::to_chars(buffer, buffer + len, value, fmt, precision);
+            BOOST_TEST(r_exact);
+            BOOST_TEST(r_exact.ptr == buffer + len);
+
+            const auto r_short = boost::charconv::to_chars(buffer, buffer + len - 1, value, fmt, precision);
+            BOOST_TEST(r_short.ec == std::errc::value_too_large);
+        }
+    }
+}
+
+void test_double_subnormals()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        const std::uint64_t bits = dist(gen) & (UINT64_C(0x800FFFFFFFFFFFFF) >> (i % 52));
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        test_value(value, i % 60);
+    }
+
+    test_value(std::numeric_limits<double>::denorm_min(), 0);
+    test_value(std::numeric_limits<double>::denorm_min(), 1100);
+    test_value(-std::numeric_limits<double>::denorm_min(), 751);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS > 64
+
+void test_long_double()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        long double value;
+        switch (i % 4)
+        {
+            case 0:
+                value = std::ldexp(static_cast<long double>(dist(gen)), static_cast<int>(dist(gen) % 32000U) - 16000);
+                break;
+            case 1:
+                value = std::ldexp(static_cast<long double>(dist(gen)), static_cast<int>(dist(gen) % 200U) - 100);
+                break;
+            case 2:
+                value = static_cast<long double>(dist(gen) % 100000U) / 1000;
+                break;
+            default:
+                value = std::numeric_limits<long double>::denorm_min() * static_cast<long double>(dist(gen) >> (i % 64));
+                break;
+        }
+
+        test_value(i % 2 == 0 ? value : -value, i % 60);
+    }
+
+    // Large precisions, rounding of 9s, ties, and zero
+    test_value((std::numeric_limits<long double>::max)(), 0);
+    test_value((std::numeric_limits<long double>::max)(), 40);
+    test_value((std::numeric_limits<long double>::min)(), 100);
+    test_value(std::numeric_limits<long double>::denorm_min(), 5000);
+    test_value(1e-15L, 50);
+    test_value(0.5L, 0);
+    test_value(1.5L, 0);
+    test_value(2.5L, 0);
+    test_value(0.125L, 2);
+    test_value(9.9999999L, 3);
+    test_value(0.00099999L, 4);
+    test_value(0.0006L, 3);
+    test_value(0.0004L, 3);
+    test_value(123456789.0L, 2);
+    test_value(0.0L, 5);
+    test_value(-0.0L, 0);
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+
+void test_float128()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        std::uint64_t words[2] = {dist(gen), dist(gen)};
+        __float128 value;
+        switch (i % 4)
+        {
+            case 0:
+                // Random finite bit patterns
+                words[1] &= UINT64_C(0xBFFFFFFFFFFFFFFF);
+                std::memcpy(&value, words, sizeof(value));
+                break;
+            case 1:
+                value = static_cast<__float128>(words[0]) * static_cast<__float128>(words[1]) / static_cast<__float128>(UINT64_C(1) << 60);
+                break;
+            case 2:
+                value = static_cast<__float128>(words[0] % 100000U) / 1000;
+                break;
+            default:
+                // Subnormals
+                words[1] &= UINT64_C(0x8000FFFFFFFFFFFF) >> (i % 48);
+                std::memcpy(&value, words, sizeof(value));
+                break;
+        }
+
+        test_value(value, i % 60);
+    }
+
+    test_value(static_cast<__float128>(1e-15L), 50);
+    test_value(static_cast<__float128>(0.5), 0);
+    test_value(static_cast<__float128>(2.5), 0);
+    test_value(static_cast<__float128>(9.9999999), 3);
+    test_value(static_cast<__float128>(-0.0), 3);
+
+    // Shortest output must not depend on what the buffer held before
+    char buffer[64];
+    std::memset(buffer, '9', sizeof(buffer));
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<__float128>(123.25));
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), "123.25");
+}
+
+#endif
+
+int main()
+{
+    test_double_subnormals();
+
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    test_long_double();
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_QUADMATH
+    test_float128();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,122 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Fixed formatting with precisions up to 9 of values below 1e15 has its own path, which must match printf
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+template <typename T>
+void test_value(T value, int precision)
+{
+    char buffer[64];
+    char printf_buffer[64];
+
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::fixed, precision);
+    const auto printf_len = std::snprintf(printf_buffer, sizeof(printf_buffer), "%.*f", precision, static_cast<double>(value));
+    const std::string expected(printf_buffer, static_cast<std::size_t>(printf_len));
+
+    BOOST_TEST(r);
+    if (!BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Precision: " << precision << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Must fit exactly, and fail with one character less
+    const auto len = static_cast<std::ptrdiff_t>(expected.size());
+    const auto r_exact = boost::charconv::to_chars(buffer, buffer + len, value, boost::charconv::chars_format::fixed, precision);
+    BOOST_TEST(r_exact.ptr == buffer + len);
+    const auto r_short = boost::charconv::to_chars(buffer, buffer + len - 1, value, boost::charconv::chars_format::fixed, precision);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+}
+
+template <typename T, typename Unsigned>
+void test_random_bits()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<Unsigned> dist(0, (std::numeric_limits<Unsigned>::max)());
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const Unsigned bits = dist(gen);
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (std::fabs(value) < static_cast<T>(1e15))
+        {
+            test_value(value, i % 10);
+        }
+    }
+}
+
+void test_decimals()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::int64_t> dist(-1000000000, 1000000000);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const double value = static_cast<double>(dist(gen)) / std::pow(10.0, i % 12);
+        test_value(value, i % 10);
+    }
+}
+
+void test_ties()
+{
+    // Multiples of powers of 2 end in exact halves at the rounding position
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, 100000);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const double value = std::ldexp(static_cast<double>(dist(gen)), -(i % 20));
+        test_value(value, i % 10);
+    }
+
+    test_value(0.5, 0);
+    test_value(1.5, 0);
+    test_value(2.5, 0);
+    test_value(0.125, 2);
+    test_value(0.375, 2);
+    test_value(-0.5, 0);
+}
+
+void test_boundaries()
+{
+    test_value(0.0, 0);
+    test_value(-0.0, 2);
+    test_value(0.0f, 9);
+    test_value(-0.001, 2);
+    test_value(0.995, 2);
+    test_value(9.9999999999, 9);
+    test_value(999999999999999.9, 0);
+    test_value(999999999999999.9, 9);
+    test_value(std::nextafter(1e15, 0.0), 9);
+    test_value(std::numeric_limits<double>::denorm_min(), 9);
+    test_value((std::numeric_limits<double>::min)(), 9);
+    test_value(std::numeric_limits<float>::denorm_min(), 9);
+    test_value(1.23456789e-5, 9);
+    test_value(0.00000000049999999999999, 9);
+    test_value(0.0000000005, 9);
+    test_value(0.0000000015, 9);
+}
+
+int main()
+{
+    test_random_bits<double, std::uint64_t>();
+    test_random_bits<float, std::uint32_t>();
+    test_decimals();
+    test_ties();
+    test_boundaries();
+
+    return boost::report_errors();
+}
@@ -14,6 +14,7 @@
 #include <cerrno>
 #include <utility>
 #include <string>
+#include <vector>
 #include <random>
 #include <iomanip>
 #include <sstream>
@@ -123,6 +124,48 @@ void failing_ci_values()
     BOOST_TEST_CSTR_EQ(buffer2, "-1.b22914956c56fp+1019");
 }
 
+template <typename T>
+void fixed_exact_buffer(T v, const std::string& str, boost::charconv::chars_format fmt = boost::charconv::chars_format::fixed, int precision = -1)
+{
+    // The output must fit a buffer of exactly its length, and fail with one character less
+    char buffer[256] {};
+    const auto len = static_cast<std::ptrdiff_t>(str.size());
+    const auto r = precision == -1 ? boost::charconv::to_chars(buffer, buffer + len, v, fmt) :
+                                     boost::charconv::to_chars(buffer, buffer + len, v, fmt, precision);
+    BOOST_TEST(r.ec == std::errc());
+    BOOST_TEST_EQ(std::string(buffer, r.ptr), str);
+
+    const auto r_short = precision == -1 ? boost::charconv::to_chars(buffer, buffer + len - 1, v, fmt) :
+                                           boost::charconv::to_chars(buffer, buffer + len - 1, v, fmt, precision);
+    BOOST_TEST(r_short.ec == std::errc::value_too_large);
+}
+
+// General output with a large precision into buffers of every size up to its length, which go through the
+// temporary buffer. Each buffer has exactly its size, so that writing past its end is caught by sanitizers.
+template <typename T>
+void general_precision_small_buffers(T v, int precision)
+{
+    std::vector<char> full(1024);
+    const auto r = boost::charconv::to_chars(full.data(), full.data() + full.size(), v, boost::charconv::chars_format::general, precision);
+    BOOST_TEST(r.ec == std::errc());
+    const std::string str(full.data(), r.ptr);
+
+    for (std::size_t size = 1; size <= str.size(); ++size)
+    {
+        std::vector<char> buffer(size);
+        const auto r_small = boost::charconv::to_chars(buffer.data(), buffer.data() + size, v, boost::charconv::chars_format::general, precision);
+        if (size < str.size())
+        {
+            BOOST_TEST(r_small.ec == std::errc::value_too_large);
+        }
+        else
+        {
+            BOOST_TEST(r_small.ec == std::errc());
+            BOOST_TEST_EQ(std::string(buffer.data(), r_small.ptr), str);
+        }
+    }
+}
+
 template <typename T>
 void spot_check(T v, const std::string& str, boost::charconv::chars_format fmt)
 {
@@ -248,6 +291,21 @@ int main()
 
     failing_ci_values<double>();
 
+    fixed_exact_buffer(0.012042803622018372, "0.012042803622018372");
+    fixed_exact_buffer(-386475.62, "-386475.62");
+    fixed_exact_buffer(0.012042804F, "0.012042804");
+    fixed_exact_buffer(972800000.0, "972800000");
+    fixed_exact_buffer(1e-5, "0.00001");
+    fixed_exact_buffer(9.9999, "10", boost::charconv::chars_format::general, 2);
+    fixed_exact_buffer(0.099999, "0.1", boost::charconv::chars_format::general, 3);
+    fixed_exact_buffer(-1.2345678e-100, "-1.2345678e-100", boost::charconv::chars_format::general, 8);
+    fixed_exact_buffer(-0.00012345678, "-0.00012345678", boost::charconv::chars_format::general, 8);
+
+    // The longest general outputs of float and double, with a precision above the number of digits they can have
+    general_precision_small_buffers(-0xc.9108p-14F, 165);
+    general_precision_small_buffers(-(std::numeric_limits<float>::min)(), 200);
+    general_precision_small_buffers(-(std::numeric_limits<double>::min)(), 800);
+
     // Values from ryu tests
     spot_check(1.0, "1", boost::charconv::chars_format::general);
     spot_check(1.2, "1.2", boost::charconv::chars_format::general);
@@ -1048,6 +1106,16 @@ int main()
     spot_check(0.0, "0.0000000000", boost::charconv::chars_format::fixed, 10);
     spot_check(-0.0, "-0.0000000000", boost::charconv::chars_format::fixed, 10);
 
+    // Exact ties at the end of a segment round to even
+    spot_check(260483923541.324493408203125, "2.6048392354132449340820312e+11", boost::charconv::chars_format::scientific, 25);
+
+    // Sign is kept when no decimal point is printed
+    spot_check(-514380.4, "-514380", boost::charconv::chars_format::fixed, 0);
+
+    // Rounding all 9s carries into the leading zeros
+    spot_check(0.0099926791406022789227, "0.0100", boost::charconv::chars_format::fixed, 4);
+    spot_check(-0.0999996, "-0.10000", boost::charconv::chars_format::fixed, 5);
+
     #ifdef BOOST_CHARCONV_HAS_FLOAT16
     {
         constexpr int N = 1024;
@@ -0,0 +1,131 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars_n must write exactly what to_chars writes for each value, with the separators in between
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <limits>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+std::string expected_output(const std::vector<double>& values, boost::charconv::chars_format fmt, char separator)
+{
+    std::string str;
+    char buffer[512];
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            str += separator;
+        }
+
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), values[i], fmt);
+        BOOST_TEST(r);
+        str.append(buffer, r.ptr);
+    }
+
+    return str;
+}
+
+void test_values(const std::vector<double>& values, boost::charconv::chars_format fmt, char separator)
+{
+    const auto expected = expected_output(values, fmt, separator);
+    std::vector<char> buffer(expected.size() + 64, '*');
+
+    const auto r = boost::charconv::to_chars_n(buffer.data(), buffer.data() + buffer.size(), values.data(), values.size(), fmt, separator);
+    BOOST_TEST(r);
+
+    // Nothing may be written past the output, so that a terminating null character can be relied on
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        BOOST_TEST(std::string(r.ptr, buffer.data() + buffer.size()) == std::string(64, '*'));
+    }
+    if (!BOOST_TEST(std::string(buffer.data(), r.ptr) == expected))
+    {
+        std::cerr << "Format: " << static_cast<unsigned>(fmt) << "\nValues: " << values.size() << std::endl; // LCOV_EXCL_LINE
+    }
+
+    // Exactly the length of the output, which hex does not fit into as in to_chars
+    if (!expected.empty() && fmt != boost::charconv::chars_format::hex)
+    {
+        std::vector<char> exact(expected.size());
+        const auto r_exact = boost::charconv::to_chars_n(exact.data(), exact.data() + exact.size(), values.data(), values.size(), fmt, separator);
+        BOOST_TEST(r_exact);
+        BOOST_TEST(std::string(exact.data(), r_exact.ptr) == expected);
+    }
+
+    // One character short
+    if (!expected.empty())
+    {
+        const auto r_short = boost::charconv::to_chars_n(buffer.data(), buffer.data() + expected.size() - 1, values.data(), values.size(), fmt, separator);
+        BOOST_TEST(r_short.ec == std::errc::value_too_large);
+        BOOST_TEST(r_short.ptr == buffer.data() + expected.size() - 1);
+    }
+}
+
+int main()
+{
+    constexpr boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                         boost::charconv::chars_format::scientific,
+                                                         boost::charconv::chars_format::fixed,
+                                                         boost::charconv::chars_format::hex};
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, (std::numeric_limits<std::uint64_t>::max)());
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        // Sizes around the block size of the implementation
+        std::vector<double> values(static_cast<std::size_t>(dist(gen) % 100U));
+
+        for (auto& value : values)
+        {
+            const auto bits = dist(gen);
+            std::memcpy(&value, &bits, sizeof(value));
+
+            switch (bits % 5U)
+            {
+                case 0:
+                    // Few significant digits, with trailing zeros in the shortest representation
+                    value = static_cast<double>(static_cast<std::int64_t>(bits >> 40) - 8000000) / 1000;
+                    break;
+                case 1:
+                    value = std::ldexp(static_cast<double>(bits >> 11), static_cast<int>(bits % 200U) - 100);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        test_values(values, formats[i % 4], i % 2 == 0 ? ',' : ' ');
+    }
+
+    const std::vector<double> special_values {0.0, -0.0, 1.0, -1.0, 1e16, 1e-5, 123456789012345678.0, 1e22, 1e23,
+                                              (std::numeric_limits<double>::max)(), (std::numeric_limits<double>::min)(),
+                                              std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::infinity(),
+                                              -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+
+    for (const auto fmt : formats)
+    {
+        test_values(special_values, fmt, ',');
+        test_values({}, fmt, ',');
+        test_values({-0.0}, fmt, ',');
+    }
+
+    // The example from the documentation
+    const double values[] = {1.5, -0.25, 1e300};
+    char buffer[64] {};
+    const auto r = boost::charconv::to_chars_n(buffer, buffer + sizeof(buffer) - 1, values, 3);
+    BOOST_TEST(r);
+    BOOST_TEST_CSTR_EQ(buffer, "1.5,-0.25,1e+300");
+
+    return boost::report_errors();
+}
@@ -291,6 +291,7 @@ template<> void test_sprintf_float( long double value, boost::charconv::chars_fo
         switch (fmt)
         {
             case boost::charconv::chars_format::general:
+            case boost::charconv::chars_format::json:
                 error_format = "General";
                 break;
             case boost::charconv::chars_format::scientific: